@@ -0,0 +1,11 @@
+/**
+ * @file    main.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+ISML_DISABLE_WARNINGS_PUSH
+#   include <benchmark/benchmark.h>
+ISML_DISABLE_WARNINGS_POP
+
+BENCHMARK_MAIN();
@@ -0,0 +1,183 @@
+/**
+ * @file    message.bench.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ *
+ * Measures creating (with and without a pool) and cloning a message of a
+ * quote-like type, accessing its fields by name and by handle, and routing
+ * a received quote, i.e. reading one field and forwarding the message, with
+ * the plain and the indexed layouts.
+ */
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+ISML_DISABLE_WARNINGS_PUSH
+#   include <benchmark/benchmark.h>
+ISML_DISABLE_WARNINGS_POP
+
+#include <isml/serialization/binary_io.hpp>
+#include <isml/serialization/serializers/binary_serializer.hpp>
+#include <isml/serialization/serializers/composite_serializer.hpp>
+
+#include <isml/message/message.hpp>
+#include <isml/message/message_descriptor.hpp>
+#include <isml/message/message_pool.hpp>
+
+using namespace isml;
+
+using FieldSerializer = CompositeSerializer<BinarySerializer>;
+
+namespace {
+
+auto quoteDescriptor() -> const MessageDescriptor&
+{
+    static const MessageDescriptor descriptor = []
+        {
+            MessageDescriptor quote { 1U };
+            quote.registerField<FieldSerializer, std::uint32_t>("id")
+                 .registerField<FieldSerializer, std::string>("symbol")
+                 .registerField<FieldSerializer, std::string>("venue")
+                 .registerField<FieldSerializer, std::int64_t>("bid")
+                 .registerField<FieldSerializer, std::int64_t>("ask")
+                 .registerField<FieldSerializer, std::uint32_t>("bid_size")
+                 .registerField<FieldSerializer, std::uint32_t>("ask_size")
+                 .registerField<FieldSerializer, std::uint64_t>("timestamp");
+            return quote;
+        }();
+
+    return descriptor;
+}
+
+auto createQuote(benchmark::State& state) -> void
+{
+    for (auto _ : state)
+    {
+        Message::Ptr message { new Message(quoteDescriptor(), nullptr) };
+        message->field<std::string>("symbol") = std::string("EURUSD");
+        benchmark::DoNotOptimize(message.get());
+    }
+}
+
+auto createPooledQuote(benchmark::State& state) -> void
+{
+    const auto pool = std::make_shared<MessagePool>(quoteDescriptor(), 16U);
+
+    for (auto _ : state)
+    {
+        auto message = pool->acquire(nullptr);
+        message->field<std::string>("symbol") = std::string("EURUSD");
+        benchmark::DoNotOptimize(message.get());
+    }
+
+    pool->trim();
+}
+
+auto cloneQuote(benchmark::State& state) -> void
+{
+    Message message { quoteDescriptor(), nullptr };
+    message.field<std::string>("symbol") = std::string("EURUSD");
+
+    for (auto _ : state)
+    {
+        auto clone = message.clone();
+        benchmark::DoNotOptimize(clone.get());
+    }
+}
+
+auto accessByName(benchmark::State& state) -> void
+{
+    Message message { quoteDescriptor(), nullptr };
+
+    for (auto _ : state)
+    {
+        message.field<std::int64_t>("bid") = 108'512;
+        benchmark::DoNotOptimize(message.field<std::int64_t>("ask").get());
+    }
+}
+
+auto accessByHandle(benchmark::State& state) -> void
+{
+    Message message { quoteDescriptor(), nullptr };
+    const auto bid = quoteDescriptor().fieldHandle<std::int64_t>("bid");
+    const auto ask = quoteDescriptor().fieldHandle<std::int64_t>("ask");
+
+    for (auto _ : state)
+    {
+        message.field(bid) = 108'512;
+        benchmark::DoNotOptimize(message.field(ask).get());
+    }
+}
+
+/// Encodes a quote with the plain or the indexed layout.
+auto encodeQuote(bool indexed) -> std::string
+{
+    Message message { quoteDescriptor(), nullptr };
+    message.field<std::uint32_t>("id") = 42U;
+    message.field<std::string>("symbol") = std::string("EURUSD");
+    message.field<std::string>("venue") = std::string("Interbank liquidity pool #3");
+    message.field<std::int64_t>("bid") = 108'512;
+    message.field<std::int64_t>("ask") = 108'514;
+
+    BinaryWriter writer;
+    TypedSerializationContext<BinarySerializer, BinaryWriter> context { writer };
+    if (indexed)
+        message.serializeIndexed(context);
+    else
+        message.serialize(context);
+
+    return std::string { writer.view() };
+}
+
+auto routeQuote(benchmark::State& state) -> void
+{
+    const auto frame = encodeQuote(false);
+    Message message { quoteDescriptor(), nullptr };
+    BinaryWriter writer;
+
+    for (auto _ : state)
+    {
+        BinaryReader reader { std::string_view { frame } };
+        TypedSerializationContext<BinarySerializer, BinaryReader> input { reader };
+        message.deserialize(input);
+        benchmark::DoNotOptimize(std::as_const(message).field<std::uint32_t>("id").get());
+
+        writer.clear();
+        TypedSerializationContext<BinarySerializer, BinaryWriter> output { writer };
+        message.serialize(output);
+        benchmark::DoNotOptimize(writer.data());
+    }
+}
+
+auto routeIndexedQuote(benchmark::State& state) -> void
+{
+    const auto frame = encodeQuote(true);
+    Message message { quoteDescriptor(), nullptr };
+    BinaryWriter writer;
+
+    for (auto _ : state)
+    {
+        BinaryReader reader { std::string_view { frame } };
+        TypedSerializationContext<BinarySerializer, BinaryReader> input { reader };
+        message.deserializeIndexed(input);
+        benchmark::DoNotOptimize(std::as_const(message).field<std::uint32_t>("id").get());
+
+        writer.clear();
+        TypedSerializationContext<BinarySerializer, BinaryWriter> output { writer };
+        message.serializeIndexed(output);
+        benchmark::DoNotOptimize(writer.data());
+    }
+}
+
+} // namespace
+
+BENCHMARK(createQuote);
+BENCHMARK(createPooledQuote);
+BENCHMARK(cloneQuote);
+BENCHMARK(accessByName);
+BENCHMARK(accessByHandle);
+BENCHMARK(routeQuote);
+BENCHMARK(routeIndexedQuote);
@@ -0,0 +1,112 @@
+/**
+ * @file    compact_binary_serializer.bench.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ *
+ * Compares the wire size and the encoding/decoding cost of BinarySerializer
+ * and CompactBinarySerializer on a record of mostly small integers.
+ */
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+ISML_DISABLE_WARNINGS_PUSH
+#   include <benchmark/benchmark.h>
+ISML_DISABLE_WARNINGS_POP
+
+#include <isml/serialization/serialization_utility.hpp>
+#include <isml/serialization/serializers/binary_serializer.hpp>
+#include <isml/serialization/serializers/compact_binary_serializer.hpp>
+
+using namespace isml;
+
+using FieldSerializer = CompositeSerializer<BinarySerializer, CompactBinarySerializer>;
+
+namespace {
+
+struct Sample : Serializable
+{
+    std::uint16_t              type      { 42U };
+    std::uint32_t              sequence  { 1000U };
+    std::int32_t               delta     { -3 };
+    std::uint64_t              timestamp { 1'700'000'000'000ULL };
+    std::string                name      { "sensor-17" };
+    std::vector<std::int32_t>  readings  {};
+
+    Sample()
+    {
+        for (std::int32_t i = 0; i < 32; ++i)
+            readings.push_back((i % 5) - 2);
+    }
+
+    auto serialize(SerializationContext& context) const -> void override
+    {
+        isml::serialize<FieldSerializer>(context, type, "type");
+        isml::serialize<FieldSerializer>(context, sequence, "sequence");
+        isml::serialize<FieldSerializer>(context, delta, "delta");
+        isml::serialize<FieldSerializer>(context, timestamp, "timestamp");
+        isml::serialize<FieldSerializer>(context, name, "name");
+        isml::serialize<FieldSerializer>(context, readings, "readings");
+    }
+
+    auto deserialize(SerializationContext& context) -> void override
+    {
+        isml::deserialize<FieldSerializer>(context, type, "type");
+        isml::deserialize<FieldSerializer>(context, sequence, "sequence");
+        isml::deserialize<FieldSerializer>(context, delta, "delta");
+        isml::deserialize<FieldSerializer>(context, timestamp, "timestamp");
+        isml::deserialize<FieldSerializer>(context, name, "name");
+        isml::deserialize<FieldSerializer>(context, readings, "readings");
+    }
+};
+
+template<template<typename...> typename Serializer>
+auto encode(const Sample& sample, BinaryWriter& writer) -> void
+{
+    writer.clear();
+    TypedSerializationContext<Serializer, BinaryWriter> context { writer };
+    serialize<Serializer>(context, sample, "");
+}
+
+template<template<typename...> typename Serializer>
+auto encodeSample(benchmark::State& state) -> void
+{
+    const Sample sample;
+    BinaryWriter writer;
+
+    for (auto _ : state)
+    {
+        encode<Serializer>(sample, writer);
+        benchmark::DoNotOptimize(writer.data());
+    }
+
+    state.counters["wire_bytes"] = static_cast<double>(writer.size());
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * writer.size()));
+}
+
+template<template<typename...> typename Serializer>
+auto decodeSample(benchmark::State& state) -> void
+{
+    BinaryWriter writer;
+    encode<Serializer>(Sample {}, writer);
+
+    Sample sample;
+    for (auto _ : state)
+    {
+        BinaryReader reader { writer.view() };
+        TypedSerializationContext<Serializer, BinaryReader> context { reader };
+        deserialize<Serializer>(context, sample, "");
+        benchmark::DoNotOptimize(sample.readings.data());
+    }
+
+    state.counters["wire_bytes"] = static_cast<double>(writer.size());
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * writer.size()));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(encodeSample, BinarySerializer);
+BENCHMARK_TEMPLATE(encodeSample, CompactBinarySerializer);
+BENCHMARK_TEMPLATE(decodeSample, BinarySerializer);
+BENCHMARK_TEMPLATE(decodeSample, CompactBinarySerializer);
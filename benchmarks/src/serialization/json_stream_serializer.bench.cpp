@@ -0,0 +1,179 @@
+/**
+ * @file    json_stream_serializer.bench.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ *
+ * Compares JsonStreamSerializer with the jsoncpp-based JsonSerializer from
+ * the custom serializer example. Both produce and consume JSON text: the
+ * example builds a Json::Value tree and writes it out, parses the text into
+ * a tree and reads the fields back.
+ */
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+ISML_DISABLE_WARNINGS_PUSH
+#   include <benchmark/benchmark.h>
+#   include <json/json.h>
+ISML_DISABLE_WARNINGS_POP
+
+#include <isml/serialization/serializable.hpp>
+#include <isml/serialization/serialization_utility.hpp>
+#include <isml/serialization/serializers/json_serializer.hpp>
+#include <isml/serialization/serializers/json_stream_serializer.hpp>
+
+using namespace isml;
+
+using FieldSerializer = CompositeSerializer<JsonSerializer, JsonStreamSerializer>;
+
+namespace {
+
+struct Trader : Serializable
+{
+    std::string   name { "desk-trader-07" };
+    std::uint32_t desk { 12U };
+
+    auto serialize(SerializationContext& context) const -> void override
+    {
+        isml::serialize<FieldSerializer>(context, name, "name");
+        isml::serialize<FieldSerializer>(context, desk, "desk");
+    }
+
+    auto deserialize(SerializationContext& context) -> void override
+    {
+        isml::deserialize<FieldSerializer>(context, name, "name");
+        isml::deserialize<FieldSerializer>(context, desk, "desk");
+    }
+};
+
+struct Quote : Serializable
+{
+    std::uint32_t id        { 918273U };
+    std::string   symbol    { "EURUSD" };
+    std::string   venue     { "LMAX" };
+    std::int64_t  bid       { 108'512 };
+    std::int64_t  ask       { 108'517 };
+    std::uint32_t bid_size  { 1'000'000U };
+    std::uint32_t ask_size  { 2'500'000U };
+    std::uint64_t timestamp { 1'700'000'000'123'456ULL };
+    Trader        trader    {};
+
+    auto serialize(SerializationContext& context) const -> void override
+    {
+        isml::serialize<FieldSerializer>(context, id, "id");
+        isml::serialize<FieldSerializer>(context, symbol, "symbol");
+        isml::serialize<FieldSerializer>(context, venue, "venue");
+        isml::serialize<FieldSerializer>(context, bid, "bid");
+        isml::serialize<FieldSerializer>(context, ask, "ask");
+        isml::serialize<FieldSerializer>(context, bid_size, "bid_size");
+        isml::serialize<FieldSerializer>(context, ask_size, "ask_size");
+        isml::serialize<FieldSerializer>(context, timestamp, "timestamp");
+        isml::serialize<FieldSerializer>(context, trader, "trader");
+    }
+
+    auto deserialize(SerializationContext& context) -> void override
+    {
+        isml::deserialize<FieldSerializer>(context, id, "id");
+        isml::deserialize<FieldSerializer>(context, symbol, "symbol");
+        isml::deserialize<FieldSerializer>(context, venue, "venue");
+        isml::deserialize<FieldSerializer>(context, bid, "bid");
+        isml::deserialize<FieldSerializer>(context, ask, "ask");
+        isml::deserialize<FieldSerializer>(context, bid_size, "bid_size");
+        isml::deserialize<FieldSerializer>(context, ask_size, "ask_size");
+        isml::deserialize<FieldSerializer>(context, timestamp, "timestamp");
+        isml::deserialize<FieldSerializer>(context, trader, "trader");
+    }
+};
+
+auto encodeStream(const Quote& quote, JsonWriter& writer) -> void
+{
+    writer.clear();
+    TypedSerializationContext<JsonStreamSerializer, JsonWriter> context { writer };
+    json::serialize(context, quote);
+}
+
+auto encodeTree(const Quote& quote, const Json::StreamWriterBuilder& builder) -> std::string
+{
+    Json::Value root;
+    auto context = SerializationContext::create<JsonSerializer>(root);
+    quote.serialize(context);
+    return Json::writeString(builder, root);
+}
+
+auto encodeStreamQuote(benchmark::State& state) -> void
+{
+    const Quote quote;
+    JsonWriter writer;
+
+    for (auto _ : state)
+    {
+        encodeStream(quote, writer);
+        benchmark::DoNotOptimize(writer.data());
+    }
+
+    state.counters["json_bytes"] = static_cast<double>(writer.size());
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * writer.size()));
+}
+
+auto encodeTreeQuote(benchmark::State& state) -> void
+{
+    const Quote quote;
+    Json::StreamWriterBuilder builder;
+    builder["indentation"] = "";
+
+    std::string text;
+    for (auto _ : state)
+    {
+        text = encodeTree(quote, builder);
+        benchmark::DoNotOptimize(text.data());
+    }
+
+    state.counters["json_bytes"] = static_cast<double>(text.size());
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * text.size()));
+}
+
+auto decodeStreamQuote(benchmark::State& state) -> void
+{
+    JsonWriter writer;
+    encodeStream(Quote {}, writer);
+
+    Quote quote;
+    for (auto _ : state)
+    {
+        JsonReader reader { writer.view() };
+        TypedSerializationContext<JsonStreamSerializer, JsonReader> context { reader };
+        json::deserialize(context, quote);
+        benchmark::DoNotOptimize(quote.symbol.data());
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * writer.size()));
+}
+
+auto decodeTreeQuote(benchmark::State& state) -> void
+{
+    Json::StreamWriterBuilder writer_builder;
+    writer_builder["indentation"] = "";
+    const auto text = encodeTree(Quote {}, writer_builder);
+
+    const std::unique_ptr<Json::CharReader> parser { Json::CharReaderBuilder {}.newCharReader() };
+
+    Quote quote;
+    for (auto _ : state)
+    {
+        Json::Value root;
+        parser->parse(text.data(), text.data() + text.size(), &root, nullptr);
+        auto context = SerializationContext::create<JsonSerializer>(root);
+        quote.deserialize(context);
+        benchmark::DoNotOptimize(quote.symbol.data());
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * text.size()));
+}
+
+} // namespace
+
+BENCHMARK(encodeStreamQuote);
+BENCHMARK(encodeTreeQuote);
+BENCHMARK(decodeStreamQuote);
+BENCHMARK(decodeTreeQuote);
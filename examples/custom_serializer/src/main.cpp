@@ -59,6 +59,9 @@ auto main() -> int
                           .registerField<FieldSerializer, UserInfo>("userInfo");
             });
 
+    // Step 3. Freeze the registry, the messages are created without locks
+    message_factory.freeze();
+
     boost::asio::io_context ioc;
     TcpTransportFactory transport_factory { ioc };
 
@@ -93,11 +96,11 @@ auto main() -> int
     }
 
     {
-        std::stringstream stream;
-        auto context = SerializationContext::create<BinarySerializer>(stream);
+        BinaryWriter writer;
+        auto context = SerializationContext::create<BinarySerializer>(writer);
         message->serialize(context);
 
-        std::cout << "Binary:\n" << stream.str() << std::endl;
+        std::cout << "Binary:\n" << writer.view() << std::endl;
     }
 
     session->shutdown();
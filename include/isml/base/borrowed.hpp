@@ -0,0 +1,240 @@
+/**
+ * @file    borrowed.hpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#ifndef ISML_BORROWED_HPP
+#define ISML_BORROWED_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <isml/utility/shared_buffer.hpp>
+
+namespace isml {
+
+/**
+ * @class   BorrowedString
+ * @brief   String referring to the bytes of a shared buffer, e.g. the frame
+ *          a message was decoded from, instead of owning a copy of them. The
+ *          value keeps a reference to the buffer, so it stays valid as long
+ *          as the message (or a copy of the value) is alive.
+ *
+ *          A value created from a plain view doesn't keep the bytes alive:
+ *          the caller does, as with std::string_view. Decoded values always
+ *          refer to a buffer. A message copies such values into buffers of
+ *          its own when it is cloned or queued for sending (see
+ *          Message::own()).
+ *
+ *          Borrowed values are encoded as the owning ones, so a peer may
+ *          declare the field as std::string.
+ * @since   0.1.7
+ */
+
+class BorrowedString
+{
+public:
+    BorrowedString() = default;
+
+    explicit BorrowedString(std::string_view view) noexcept
+        : m_view(view)
+    {}
+
+    explicit BorrowedString(const char* value) noexcept
+        : m_view(value)
+    {}
+
+    BorrowedString(SharedBuffer buffer, std::string_view view) noexcept
+        : m_buffer(std::move(buffer))
+        , m_view(view)
+    {}
+
+public:
+    auto view() const noexcept -> std::string_view
+    {
+        return m_view;
+    }
+
+    operator std::string_view() const noexcept
+    {
+        return m_view;
+    }
+
+    auto data() const noexcept -> const char*
+    {
+        return m_view.data();
+    }
+
+    auto size() const noexcept -> std::size_t
+    {
+        return m_view.size();
+    }
+
+    auto empty() const noexcept -> bool
+    {
+        return m_view.empty();
+    }
+
+    /// Gets the buffer the bytes lie within; empty for a plain view.
+    auto buffer() const noexcept -> const SharedBuffer&
+    {
+        return m_buffer;
+    }
+
+    /// Checks if the value refers to bytes it doesn't keep alive.
+    auto unowned() const noexcept -> bool
+    {
+        return !m_buffer and !m_view.empty();
+    }
+
+    /// Gets a value keeping its bytes alive, copying them into a new buffer if needed.
+    auto owned() const -> BorrowedString
+    {
+        if (!unowned())
+            return *this;
+
+        auto buffer = SharedBuffer::copy(nullptr, m_view);
+        const auto view = buffer.view();
+        return BorrowedString { std::move(buffer), view };
+    }
+
+    /// Creates an owning copy of the string.
+    auto materialize() const -> std::string
+    {
+        return std::string { m_view };
+    }
+
+    friend auto operator==(const BorrowedString& lhs, const BorrowedString& rhs) noexcept -> bool
+    {
+        return lhs.m_view == rhs.m_view;
+    }
+
+protected:
+    SharedBuffer     m_buffer {};
+    std::string_view m_view   {};
+};
+
+/**
+ * @class   BorrowedBytes
+ * @brief   Byte span referring to the bytes of a shared buffer, the borrowed
+ *          counterpart of std::vector<std::uint8_t> (see BorrowedString).
+ * @since   0.1.7
+ */
+
+class BorrowedBytes
+{
+public:
+    using value_type = std::uint8_t;
+
+public:
+    BorrowedBytes() = default;
+
+    explicit BorrowedBytes(std::span<const std::uint8_t> bytes) noexcept
+        : m_bytes(bytes)
+    {}
+
+    BorrowedBytes(SharedBuffer buffer, std::string_view bytes) noexcept
+        : m_buffer(std::move(buffer))
+        , m_bytes(reinterpret_cast<const std::uint8_t*>(bytes.data()), bytes.size())
+    {}
+
+public:
+    auto span() const noexcept -> std::span<const std::uint8_t>
+    {
+        return m_bytes;
+    }
+
+    operator std::span<const std::uint8_t>() const noexcept
+    {
+        return m_bytes;
+    }
+
+    auto data() const noexcept -> const std::uint8_t*
+    {
+        return m_bytes.data();
+    }
+
+    auto size() const noexcept -> std::size_t
+    {
+        return m_bytes.size();
+    }
+
+    auto empty() const noexcept -> bool
+    {
+        return m_bytes.empty();
+    }
+
+    auto begin() const noexcept
+    {
+        return m_bytes.begin();
+    }
+
+    auto end() const noexcept
+    {
+        return m_bytes.end();
+    }
+
+    /// @copydoc BorrowedString::buffer()
+    auto buffer() const noexcept -> const SharedBuffer&
+    {
+        return m_buffer;
+    }
+
+    /// @copydoc BorrowedString::unowned()
+    auto unowned() const noexcept -> bool
+    {
+        return !m_buffer and !m_bytes.empty();
+    }
+
+    /// @copydoc BorrowedString::owned()
+    auto owned() const -> BorrowedBytes
+    {
+        if (!unowned())
+            return *this;
+
+        auto buffer = SharedBuffer::copy(nullptr,
+            std::string_view { reinterpret_cast<const char*>(m_bytes.data()), m_bytes.size() });
+        const auto view = buffer.view();
+        return BorrowedBytes { std::move(buffer), view };
+    }
+
+    /// Creates an owning copy of the bytes.
+    auto materialize() const -> std::vector<std::uint8_t>
+    {
+        return { m_bytes.begin(), m_bytes.end() };
+    }
+
+    friend auto operator==(const BorrowedBytes& lhs, const BorrowedBytes& rhs) noexcept -> bool
+    {
+        return std::ranges::equal(lhs.m_bytes, rhs.m_bytes);
+    }
+
+protected:
+    SharedBuffer                  m_buffer {};
+    std::span<const std::uint8_t> m_bytes  {};
+};
+
+/// Check whether T is a borrowed string or byte span
+template<typename T>
+struct IsBorrowed : std::false_type
+{};
+
+template<>
+struct IsBorrowed<BorrowedString> : std::true_type
+{};
+
+template<>
+struct IsBorrowed<BorrowedBytes> : std::true_type
+{};
+
+} // namespace isml
+
+#endif // ISML_BORROWED_HPP
@@ -38,6 +38,15 @@ public:
         requires std::is_floating_point_v<T>
     static auto swap(T& value) noexcept -> void;
 
+    /**
+     * @brief   Swaps bytes of each value in the range. Iterations don't
+     *          depend on each other, so the loop is vectorized.
+     */
+
+    template<typename T>
+        requires std::is_arithmetic_v<T>
+    static auto swap(T* values, std::size_t count) noexcept -> void;
+
 public:
     ByteUtils() = delete;
 };
@@ -93,6 +102,14 @@ auto ByteUtils::swap(T& value) noexcept -> void
             reinterpret_cast<const unsigned char*>(&original_value)[sizeof(T) - 1 - i];
 }
 
+template<typename T>
+    requires std::is_arithmetic_v<T>
+auto ByteUtils::swap(T* values, std::size_t count) noexcept -> void
+{
+    for (std::size_t i = 0; i < count; ++i)
+        swap(values[i]);
+}
+
 } // namespace isml
 
 #endif // ISML_BYTE_HPP
@@ -21,8 +21,10 @@ using word            = std::uint16_t;             ///< Word type.
 using MessageType = std::uint16_t;
 using MessageLength = std::uint16_t; ///< Message length type.
 using MessageId = std::uint32_t;     ///< Message identifier type.
+using StreamId = std::uint16_t;      ///< Logical stream identifier type.
 
 constexpr auto k_bad_msg_id = static_cast<MessageId>(0);
+constexpr auto k_reserved_msg_type = static_cast<MessageType>(0xFFFF); ///< Used by the transports (hello message).
 
 using SessionId = std::uint64_t;
 const SessionId kBadSessionId = 0;
@@ -30,7 +30,16 @@ public:
     Field() = delete;
     Field(const Field& other);
     Field(Field&&) = delete;
-    explicit Field(std::string name) noexcept;
+    explicit Field(std::string name);
+
+    /**
+     * @brief   Constructs a field referring to the name owned by its
+     *          descriptor (fields of messages don't copy their names).
+     *
+     * @param   name  Field name; must outlive the field.
+     */
+
+    explicit Field(const std::string* name) noexcept;
 
     virtual ~Field() = default;
 
@@ -50,6 +59,18 @@ public:
 
     virtual auto clone() const noexcept -> Ptr = 0;
 
+    /**
+     * @brief   Creates a clone of the current field in the storage provided
+     *          by the caller, e.g. the storage of a field set. The clone is
+     *          destroyed by calling the destructor.
+     *
+     * @param   storage  Storage of the size and alignment of the field.
+     *
+     * @return  A pointer to the created field.
+     */
+
+    virtual auto cloneAt(void* storage) const -> Field* = 0;
+
     /**
      * @brief   Returns an info about the value type.
      *          Must be override by derived classes.
@@ -68,8 +89,32 @@ public:
 
     virtual auto serializedSize() const noexcept -> std::size_t = 0;
 
+    /// Checks if the field holds the default (value-initialized) value.
+    virtual auto isDefault() const noexcept -> bool = 0;
+
+    /// Sets the default (value-initialized) value.
+    virtual auto reset() -> void = 0;
+
+    /**
+     * @brief   Compares the values of the fields. Fields of different value
+     *          types and values that can't be compared are never equal.
+     */
+
+    virtual auto equals(const Field& other) const noexcept -> bool = 0;
+
+    /**
+     * @brief   Checks if the value refers to bytes it doesn't keep alive, e.g.
+     *          a borrowed string created from a plain view.
+     */
+
+    virtual auto unowned() const noexcept -> bool = 0;
+
+    /// Copies the bytes an unowned value refers to into a buffer of its own.
+    virtual auto own() -> void = 0;
+
 protected:
-    const std::string m_name;
+    std::unique_ptr<const std::string> m_own_name {};  ///< Name of a standalone field.
+    const std::string*                 m_name     {};
 };
 
 } // namespace isml
@@ -7,12 +7,34 @@
 #ifndef ISML_FIELD_DESCRIPTOR_HPP
 #define ISML_FIELD_DESCRIPTOR_HPP
 
+#include <cstddef>
 #include <memory>
+#include <string>
+#include <typeinfo>
+
+#include <isml/base/maybe.hpp>
 
 #include <isml/message/field/field.hpp>
 
 namespace isml {
 
+/**
+ * @class   FixedEncoding
+ * @brief   Binary encoding of a fixed-size value having the same
+ *          representation in memory and on the wire up to the byte order,
+ *          so it is written by copying the bytes of the field (see
+ *          FieldLayout::fixed()).
+ */
+
+struct FixedEncoding
+{
+    std::size_t value_offset {};  ///< Offset of the value within the field object.
+    std::size_t size         {};  ///< Size of the value.
+    std::size_t element_size {};  ///< Size of the elements swapped on big-endian hosts.
+    std::size_t count        {};  ///< Number of elements.
+    bool        counted      {};  ///< The value is preceded by the element count (arrays).
+};
+
 /**
  * @class   FieldDescriptor
  * @brief   Serves as a base class for other classes representing field descriptors.
@@ -46,6 +68,39 @@ public:
 
     virtual auto createField() const noexcept -> Field::Ptr = 0;
 
+    /**
+     * @brief   Creates a field in the storage provided by the caller. The
+     *          field refers to the name of the descriptor, so the descriptor
+     *          must outlive it.
+     *
+     * @param   storage  Storage of fieldSize() bytes aligned to fieldAlignment().
+     *
+     * @return  A pointer to the created field.
+     */
+
+    virtual auto constructField(void* storage) const -> Field* = 0;
+
+    /// Gets the size of the field object created by constructField().
+    virtual auto fieldSize() const noexcept -> std::size_t = 0;
+
+    /// Gets the alignment of the field object created by constructField().
+    virtual auto fieldAlignment() const noexcept -> std::size_t = 0;
+
+    /// Returns an info about the value type of the field.
+    virtual auto valueType() const noexcept -> const std::type_info& = 0;
+
+    /// Returns a portable description of the value type (see typeSignature()).
+    virtual auto valueSignature() const -> std::string = 0;
+
+    /**
+     * @brief   Returns the encoding of the field by the binary serializer if
+     *          the value is copied as is, i.e. it is a trivially copyable
+     *          value of a fixed size. By default fields are encoded by their
+     *          serializer only.
+     */
+
+    virtual auto fixedEncoding() const -> Maybe<FixedEncoding>;
+
     /**
      * @brief   Creates a clone of the current descriptor.
      *
@@ -0,0 +1,93 @@
+/**
+ * @file    field_handle.hpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#ifndef ISML_FIELD_HANDLE_HPP
+#define ISML_FIELD_HANDLE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include <isml/base_types.hpp>
+
+namespace isml {
+
+class FieldLayout;
+class MessageDescriptor;
+
+/**
+ * @class   FieldHandle
+ * @brief   Refers to a field of messages of one type by its index in the
+ *          field layout. A handle is obtained once from the message
+ *          descriptor, which checks the name and the value type, and then
+ *          resolves the field of any message of the type without hashing
+ *          the name or comparing type information.
+ *
+ *          The handle keeps the layout it was obtained from. A message of
+ *          that layout is accessed at once, for another one the message type
+ *          and the value type of the field are checked (see Message::field).
+ *          Registering more fields keeps the indices of the existing ones,
+ *          so a handle stays valid for the later messages of the type.
+ *
+ * @tparam  T Value type.
+ * @since   0.1.7
+ */
+
+template<typename T>
+class FieldHandle final
+{
+    friend class MessageDescriptor;
+
+public:
+    FieldHandle() = delete;
+
+public:
+    /// Gets the type of the messages the field belongs to.
+    auto messageType() const noexcept -> MessageType;
+
+    /// Gets the index of the field in the layout.
+    auto index() const noexcept -> std::size_t;
+
+    /// Gets the layout the handle was obtained from.
+    auto layout() const noexcept -> const std::shared_ptr<const FieldLayout>&;
+
+private:
+    FieldHandle(MessageType message_type, std::size_t index, std::shared_ptr<const FieldLayout> layout) noexcept;
+
+private:
+    MessageType                        m_message_type;
+    std::size_t                        m_index;
+    std::shared_ptr<const FieldLayout> m_layout;  ///< Kept, so that its address isn't reused by another layout.
+};
+
+template<typename T>
+inline FieldHandle<T>::FieldHandle(MessageType message_type, std::size_t index, std::shared_ptr<const FieldLayout> layout) noexcept
+    : m_message_type(message_type)
+    , m_index(index)
+    , m_layout(std::move(layout))
+{}
+
+template<typename T>
+inline auto FieldHandle<T>::messageType() const noexcept -> MessageType
+{
+    return m_message_type;
+}
+
+template<typename T>
+inline auto FieldHandle<T>::index() const noexcept -> std::size_t
+{
+    return m_index;
+}
+
+template<typename T>
+inline auto FieldHandle<T>::layout() const noexcept -> const std::shared_ptr<const FieldLayout>&
+{
+    return m_layout;
+}
+
+} // namespace isml
+
+#endif // ISML_FIELD_HANDLE_HPP
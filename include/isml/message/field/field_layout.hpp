@@ -0,0 +1,162 @@
+/**
+ * @file    field_layout.hpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#ifndef ISML_FIELD_LAYOUT_HPP
+#define ISML_FIELD_LAYOUT_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <isml/base/maybe.hpp>
+
+#include <isml/message/field/field_descriptor.hpp>
+
+namespace isml {
+
+/**
+ * @class   FieldLayout
+ * @brief   Precomputed layout of the fields of a message type: the field
+ *          descriptors in the registration order, the offsets of the field
+ *          objects within the storage of a field set and the name to index
+ *          table. A layout is immutable and is shared by the message
+ *          descriptor and all messages created from it, so the storage of a
+ *          message is a single allocation and a lookup by name doesn't
+ *          touch per-message data.
+ *
+ *          The storage starts with a table of pointers to the fields
+ *          followed by the field objects.
+ *
+ *          A layout whose fields are all fixed-size values copied as is by
+ *          the binary serializer (see FieldDescriptor::fixedEncoding()) is
+ *          fixed: the binary encoding of its messages has a constant size
+ *          and the value of each field lies at a precomputed offset.
+ * @since   0.1.7
+ */
+
+class FieldLayout final
+{
+public:
+    using Ptr = std::shared_ptr<const FieldLayout>;
+    using Descriptors = std::vector<std::shared_ptr<const FieldDescriptor>>;
+
+    /// Value of a field of a fixed layout copied between the storage and the encoded fields.
+    struct FixedField
+    {
+        std::size_t storage_offset {};  ///< Offset of the value within the storage.
+        std::size_t wire_offset    {};  ///< Offset of the value within the encoded fields.
+        std::size_t size           {};
+        std::size_t element_size   {};
+        std::size_t count          {};
+        bool        counted        {};  ///< The value is preceded by the element count.
+    };
+
+    using FixedFields = std::vector<FixedField>;
+
+public:
+    FieldLayout() = default;
+    explicit FieldLayout(Descriptors descriptors);
+
+    // non-copyable
+    FieldLayout(const FieldLayout&) = delete;
+    auto operator=(const FieldLayout&) -> FieldLayout& = delete;
+
+public:
+
+    /**
+     * @brief   Creates a layout having the fields of the current one and the
+     *          new field.
+     *
+     * @param   descriptor  Field descriptor.
+     *
+     * @throw   InvalidArgumentException  If there is a field with the same name.
+     */
+
+    auto extend(std::shared_ptr<const FieldDescriptor> descriptor) const -> Ptr;
+
+    /// Gets the field descriptors in the registration order.
+    auto descriptors() const noexcept -> const Descriptors&;
+
+    /// Gets the number of fields.
+    auto size() const noexcept -> std::size_t;
+
+    /// Gets the index of the named field.
+    auto indexOf(std::string_view name) const noexcept -> Maybe<std::size_t>;
+
+    /// Gets the offset of the i-th field object within the storage.
+    auto offset(std::size_t index) const noexcept -> std::size_t;
+
+    /// Gets the size of the storage of a field set.
+    auto storageSize() const noexcept -> std::size_t;
+
+    /// Gets the alignment of the storage of a field set.
+    auto storageAlignment() const noexcept -> std::size_t;
+
+    /// Checks if the layout has fields and all of them are of a fixed encoding.
+    auto fixed() const noexcept -> bool;
+
+    /// Gets the size of the binary encoding of the fields of a fixed layout.
+    auto fixedSize() const noexcept -> std::size_t;
+
+    /// Gets the fields of a fixed layout in the encoding order.
+    auto fixedFields() const noexcept -> const FixedFields&;
+
+protected:
+    Descriptors                                       m_descriptors       {};
+    std::vector<std::size_t>                          m_offsets           {};
+    std::unordered_map<std::string_view, std::size_t> m_indices           {};  ///< Keys refer to the descriptor names.
+    std::size_t                                       m_storage_size      {};
+    std::size_t                                       m_storage_alignment { alignof(Field*) };
+    FixedFields                                       m_fixed_fields      {};  ///< Empty unless the layout is fixed.
+    std::size_t                                       m_fixed_size        {};
+};
+
+inline auto FieldLayout::descriptors() const noexcept -> const Descriptors&
+{
+    return m_descriptors;
+}
+
+inline auto FieldLayout::size() const noexcept -> std::size_t
+{
+    return m_descriptors.size();
+}
+
+inline auto FieldLayout::offset(std::size_t index) const noexcept -> std::size_t
+{
+    return m_offsets[index];
+}
+
+inline auto FieldLayout::storageSize() const noexcept -> std::size_t
+{
+    return m_storage_size;
+}
+
+inline auto FieldLayout::storageAlignment() const noexcept -> std::size_t
+{
+    return m_storage_alignment;
+}
+
+inline auto FieldLayout::fixed() const noexcept -> bool
+{
+    return !m_fixed_fields.empty();
+}
+
+inline auto FieldLayout::fixedSize() const noexcept -> std::size_t
+{
+    return m_fixed_size;
+}
+
+inline auto FieldLayout::fixedFields() const noexcept -> const FixedFields&
+{
+    return m_fixed_fields;
+}
+
+} // namespace isml
+
+#endif // ISML_FIELD_LAYOUT_HPP
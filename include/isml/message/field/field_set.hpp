@@ -7,14 +7,16 @@
 #ifndef ISML_FIELD_SET_HPP
 #define ISML_FIELD_SET_HPP
 
-#include <unordered_map>
-#include <list>
+#include <atomic>
+#include <cstddef>
+#include <string_view>
 
 #include <isml/base/maybe.hpp>
 
 #include <isml/serialization/serializable.hpp>
 
 #include <isml/message/field/field.hpp>
+#include <isml/message/field/field_layout.hpp>
 #include <isml/message/field/value_field.hpp>
 
 namespace isml {
@@ -22,38 +24,74 @@ namespace isml {
 /**
  * @class   FieldSet
  * @brief   Represents a set of message fields.
+ *
+ *          The fields are kept and serialized in the order of the layout
+ *          (the order of the message descriptor). All the fields are
+ *          constructed in a single allocation described by the layout, and
+ *          the fields are looked up by name with the table of the layout.
+ *
+ *          Copies of a field set share the storage, which is reference
+ *          counted (copy on write): the fields are copied when a copy is
+ *          first accessed for modification, i.e. through a non-const
+ *          accessor or by deserialization. Access through a const field
+ *          set never copies the fields.
+ *
+ *          The fields read with deserializeIndexed() are retained encoded
+ *          and each one is decoded on the first access to it; fields that
+ *          are not modified are serialized again by copying their bytes.
+ *          Const accessors may be used concurrently while fields are
+ *          decoded.
+ *
  * @since   0.1.0
  */
 
 class FieldSet : public Serializable
 {
-protected:
-    using Fields = std::list<Field::Ptr>;
-    using FieldsByName = std::unordered_map<std::string, Fields::iterator>;
-
 public:
     FieldSet() = default;
     FieldSet(const FieldSet& other);
     FieldSet(FieldSet&& other) noexcept;
 
-    virtual ~FieldSet() = default;
+    /// Creates the fields of the layout holding the default values.
+    explicit FieldSet(FieldLayout::Ptr layout);
+
+    virtual ~FieldSet();
 
     auto operator=(const FieldSet& other) -> FieldSet&;
     auto operator=(FieldSet&& other) -> FieldSet&;
 
 public:
-    auto add(Field::Ptr field) -> bool;
-
     auto contains(const std::string& name) const noexcept -> bool;
 
     template<typename T>
     auto contains(const std::string& name) const noexcept -> bool;
 
-    auto get(const std::string& name) -> Maybe<Field::Ptr&>;
+    auto get(const std::string& name) -> Maybe<Field&>;
+    auto get(const std::string& name) const -> Maybe<const Field&>;
 
     template<typename T>
     auto get(const std::string& name) -> Maybe<ValueField<T>&>;
 
+    template<typename T>
+    auto get(const std::string& name) const -> Maybe<const ValueField<T>&>;
+
+    /**
+     * @brief   Gets the i-th field in the order of the layout.
+     *
+     * @throw   IOException  If the field is retained encoded and is malformed.
+     */
+
+    auto at(std::size_t index) -> Field&;
+    auto at(std::size_t index) const -> const Field&;
+
+    /// Checks if the storage is shared with other field sets.
+    auto shared() const noexcept -> bool;
+
+    /// Makes the field set the only owner of its storage copying the fields if needed.
+    auto detach() -> void;
+
+    auto layout() const noexcept -> const FieldLayout::Ptr&;
+
     auto empty() const noexcept -> bool;
 
     auto size() const noexcept -> std::size_t;
@@ -64,39 +102,228 @@ public:
 
     auto clear() -> void;
 
+    /// Sets the default values of all the fields.
+    auto reset() -> void;
+
+    /**
+     * @brief   Copies the unowned values (see Field::unowned()) into buffers of
+     *          their own. The storage shared with other field sets is copied
+     *          only if there are such values.
+     */
+
+    auto own() -> void;
+
     auto serialize(SerializationContext& context) const -> void override;
 
     auto deserialize(SerializationContext& context) -> void override;
 
-    auto serializedSize() const noexcept -> std::size_t;
+    auto serializedSize() const -> std::size_t;
+
+    /**
+     * @brief   Serializes the fields preceded by the offset table: the i-th
+     *          entry is the offset of the end of the i-th field from the end
+     *          of the table (32 bits, little endian), so a field is found
+     *          without decoding the preceding ones.
+     *
+     * @param   context  Serialization context (binary IO object).
+     *
+     * @throw   InvalidCastException  If the IO object isn't a BinaryWriter.
+     */
+
+    auto serializeIndexed(SerializationContext& context) const -> void;
+
+    /**
+     * @brief   Reads the fields written by serializeIndexed() without
+     *          decoding them. The encoded fields are retained and each one is
+     *          decoded with the serializer of the context on the first
+     *          access. The context must not use a string dictionary, since
+     *          the fields are decoded out of order. The fields are retained
+     *          by reference to the backing buffer of the reader if it has
+     *          one, otherwise they are copied.
+     *
+     * @param   context  Serialization context (binary IO object).
+     *
+     * @throw   InvalidCastException      If the IO object isn't a BinaryReader.
+     * @throw   InvalidArgumentException  If the context uses a dictionary.
+     * @throw   IOException               If the offset table is malformed.
+     */
+
+    auto deserializeIndexed(SerializationContext& context) -> void;
+
+    /// Returns the size of the fields serialized with serializeIndexed().
+    auto indexedSerializedSize() const -> std::size_t;
+
+    /**
+     * @brief   Serializes the fields holding non-default values preceded by
+     *          the presence bitmap: bit i (least significant first) of byte
+     *          i / 8 is set if the i-th field is written.
+     *
+     * @param   context  Serialization context (binary IO object).
+     *
+     * @throw   InvalidCastException  If the IO object isn't a BinaryWriter.
+     */
+
+    auto serializeSparse(SerializationContext& context) const -> void;
+
+    /**
+     * @brief   Deserializes the fields written by serializeSparse(). The
+     *          omitted fields are reset to the default values.
+     *
+     * @param   context  Serialization context (binary IO object).
+     *
+     * @throw   InvalidCastException  If the IO object isn't a BinaryReader.
+     * @throw   IOException           If the bitmap is malformed.
+     */
+
+    auto deserializeSparse(SerializationContext& context) -> void;
+
+    /// Returns the size of the fields serialized with serializeSparse().
+    auto sparseSerializedSize() const -> std::size_t;
+
+    /**
+     * @brief   Serializes the fields differing from the base ones preceded by
+     *          the change bitmap (laid out as the presence one).
+     *
+     * @param   context  Serialization context (binary IO object).
+     * @param   base     Field set of the same descriptor.
+     *
+     * @throw   InvalidArgumentException  If the base has other fields.
+     * @throw   InvalidCastException      If the IO object isn't a BinaryWriter.
+     */
+
+    auto serializeDelta(SerializationContext& context, const FieldSet& base) const -> void;
+
+    /**
+     * @brief   Applies the changes written by serializeDelta(). The fields
+     *          not marked as changed are kept, so the field set must hold the
+     *          base values.
+     *
+     * @param   context  Serialization context (binary IO object).
+     *
+     * @throw   InvalidCastException  If the IO object isn't a BinaryReader.
+     * @throw   IOException           If the bitmap is malformed.
+     */
+
+    auto deserializeDelta(SerializationContext& context) -> void;
+
+    /// Returns the size of the fields serialized with serializeDelta().
+    auto deltaSerializedSize(const FieldSet& base) const -> std::size_t;
+
+protected:
+    struct Retained;
+
+    /// Serializes the i-th field, copying its retained bytes if possible.
+    auto serializeField(SerializationContext& context, std::size_t index) const -> void;
+
+    /// Gets the binary size of the i-th field without decoding it if possible.
+    auto fieldSize(std::size_t index) const -> std::size_t;
+
+    /// Decodes the i-th field if it is retained encoded.
+    auto decode(std::size_t index) const -> void;
+
+    /// Decodes the i-th field and marks it as modified, so its bytes are not reused.
+    auto modify(std::size_t index) -> void;
+
+    /// Decodes the retained fields and drops the encoded ones.
+    auto decodeRetained() -> void;
+
+    /// Releases the encoded fields.
+    auto dropRetained() noexcept -> void;
+
+    auto serializeMarked(SerializationContext& context, std::size_t bitmap_position) const -> void;
+
+    auto readBitmap(SerializationContext& context) const -> std::string_view;
+
+    /// Releases the storage, destroying the fields if it isn't shared.
+    auto destroy() noexcept -> void;
+
+    /// Copies the fields to a new storage.
+    auto copy() -> void;
+
+    /// Pointers to the fields at the beginning of the storage.
+    auto fields() const noexcept -> Field* const*;
+
+    /// Number of the field sets sharing the storage, placed after the fields.
+    auto references() const noexcept -> std::atomic<std::size_t>&;
 
 protected:
-    Fields       m_fields         {};
-    FieldsByName m_fields_by_name {};
+    FieldLayout::Ptr m_layout   {};
+    std::byte*       m_storage  {};
+    Retained*        m_retained {};  ///< Encoded fields, shared along with the storage.
 };
 
 template<typename T>
 auto FieldSet::contains(const std::string& name) const noexcept -> bool
 {
-    if (!m_fields_by_name.contains(name))
+    if (!m_layout)
         return false;
 
-    const auto& field = *m_fields_by_name.at(name);
-    return field->valueType() == typeid(T);
+    const auto index = m_layout->indexOf(name);
+    return index.isSome() and fields()[*index]->valueType() == typeid(T);
 }
 
 template<typename T>
 auto FieldSet::get(const std::string& name) -> Maybe<ValueField<T>&>
 {
     Maybe<ValueField<T>&> field { none };
-    if (contains<T>(name))
-    {
-        auto& field_ptr = *m_fields_by_name.at(name);
-        field = *reinterpret_cast<ValueField<T>*>(field_ptr.get());
-    }
+    if (!m_layout)
+        return field;
+
+    if (const auto index = m_layout->indexOf(name); index.isSome() and fields()[*index]->valueType() == typeid(T))
+        field = static_cast<ValueField<T>&>(at(*index));
     return field;
 }
 
+template<typename T>
+auto FieldSet::get(const std::string& name) const -> Maybe<const ValueField<T>&>
+{
+    Maybe<const ValueField<T>&> field { none };
+    if (!m_layout)
+        return field;
+
+    if (const auto index = m_layout->indexOf(name); index.isSome() and fields()[*index]->valueType() == typeid(T))
+        field = static_cast<const ValueField<T>&>(at(*index));
+    return field;
+}
+
+inline auto FieldSet::fields() const noexcept -> Field* const*
+{
+    return reinterpret_cast<Field* const*>(m_storage);
+}
+
+inline auto FieldSet::references() const noexcept -> std::atomic<std::size_t>&
+{
+    return *reinterpret_cast<std::atomic<std::size_t>*>(m_storage + m_layout->storageSize());
+}
+
+inline auto FieldSet::shared() const noexcept -> bool
+{
+    return m_storage and references().load(std::memory_order_acquire) != 1U;
+}
+
+inline auto FieldSet::detach() -> void
+{
+    if (shared())
+        copy();
+}
+
+inline auto FieldSet::at(std::size_t index) -> Field&
+{
+    detach();
+    if (m_retained) [[unlikely]]
+        modify(index);
+
+    return *fields()[index];
+}
+
+inline auto FieldSet::at(std::size_t index) const -> const Field&
+{
+    if (m_retained) [[unlikely]]
+        decode(index);
+
+    return *fields()[index];
+}
+
 } // namespace isml
 
 #endif // ISML_FIELD_SET_HPP
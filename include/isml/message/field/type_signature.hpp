@@ -0,0 +1,65 @@
+/**
+ * @file    type_signature.hpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#ifndef ISML_TYPE_SIGNATURE_HPP
+#define ISML_TYPE_SIGNATURE_HPP
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <isml/base/borrowed.hpp>
+#include <isml/base/type_traits.hpp>
+
+namespace isml {
+
+/**
+ * @brief   Gets a portable description of the value type of a field: the kind,
+ *          the size and the signedness of numbers and the structure of
+ *          containers, e.g. "i4" for std::int32_t or "v(f8)" for
+ *          std::vector<double>. Types encoded alike (std::string and
+ *          BorrowedString) have the same signature; other types are "x".
+ *          Unlike std::type_info::name() the signature is the same with all
+ *          compilers.
+ * @since   0.1.7
+ */
+
+template<typename T>
+auto typeSignature() -> std::string
+{
+    if constexpr (std::is_same_v<T, bool>)
+        return "b";
+    else if constexpr (std::is_same_v<T, char>)
+        return "c";  // the signedness of char depends on the platform
+    else if constexpr (std::is_integral_v<T>)
+        return (std::is_signed_v<T> ? "i" : "u") + std::to_string(sizeof(T));
+    else if constexpr (std::is_floating_point_v<T>)
+        return "f" + std::to_string(sizeof(T));
+    else if constexpr (std::is_enum_v<T>)
+        return "e" + typeSignature<std::underlying_type_t<T>>();
+    else if constexpr (std::is_same_v<T, std::string> or std::is_same_v<T, BorrowedString>)
+        return "s";
+    else if constexpr (std::is_same_v<T, BorrowedBytes>)
+        return typeSignature<std::vector<std::uint8_t>>();
+    else if constexpr (IsArray<T>::value)
+        return "a" + std::to_string(std::tuple_size_v<T>) + "(" + typeSignature<typename T::value_type>() + ")";
+    else if constexpr (IsOptional<T>::value)
+        return "o(" + typeSignature<typename T::value_type>() + ")";
+    else if constexpr (IsPair<T>::value)
+        return "p(" + typeSignature<typename T::first_type>() + "," + typeSignature<typename T::second_type>() + ")";
+    else if constexpr (requires { typename T::mapped_type; })
+        return "m(" + typeSignature<typename T::key_type>() + "," + typeSignature<typename T::mapped_type>() + ")";
+    else if constexpr (requires { typename T::key_type; })
+        return "c(" + typeSignature<typename T::key_type>() + ")";
+    else if constexpr (requires { typename T::value_type; })
+        return "v(" + typeSignature<typename T::value_type>() + ")";
+    else
+        return "x";
+}
+
+} // namespace isml
+
+#endif // ISML_TYPE_SIGNATURE_HPP
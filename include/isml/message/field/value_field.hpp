@@ -7,8 +7,11 @@
 #ifndef ISML_VALUE_FIELD_HPP
 #define ISML_VALUE_FIELD_HPP
 
+#include <concepts>
+#include <new>
 #include <string_view>
 
+#include <isml/base/borrowed.hpp>
 #include <isml/serialization/serializers/binary_serializer.hpp>
 #include <isml/message/field/field.hpp>
 
@@ -17,22 +20,18 @@ namespace isml {
 template<typename T, typename Serializer = void>
 class ValueField;
 
-template<typename T, typename Serializer>
-auto operator==(const ValueField<T, Serializer>& lhs, const ValueField<T, Serializer>& rhs) -> bool;
-
-template<typename T, typename Serializer>
-auto operator==(const ValueField<T, Serializer>& lhs, const T& rhs) -> bool;
-
 /**
- * @class   DataField
+ * @class   ValueField
  * @brief   Stores data and provides interface to access them with ability
- *          to modification.
+ *          to modification. The specialization without a serializer is the
+ *          base of the fields of all serializers, so a field can be accessed
+ *          knowing only the value type.
  * @tparam  T Stored data type.
  * @since   0.1.0
  */
 
-template<typename T, typename Serializer>
-class ValueField : public Field
+template<typename T>
+class ValueField<T, void> : public Field
 {
 public:
     using Field::Field;
@@ -68,82 +67,169 @@ public:
 
     auto set(const T& other) noexcept -> void;
 
-    auto serialize(SerializationContext& context) const -> void override;
-    auto deserialize(SerializationContext& context) -> void override;
-    auto serializedSize() const noexcept -> std::size_t override;
+    /// @copydoc Field::isDefault()
+    auto isDefault() const noexcept -> bool override;
+
+    /// @copydoc Field::reset()
+    auto reset() -> void override;
+
+    /// @copydoc Field::equals()
+    auto equals(const Field& other) const noexcept -> bool override;
+
+    /// @copydoc Field::unowned()
+    auto unowned() const noexcept -> bool override;
+
+    /// @copydoc Field::own()
+    auto own() -> void override;
 
     template<typename U = T>
     auto operator=(U&& value) -> ValueField&;
 
-    auto clone() const noexcept -> Field::Ptr override;
-
     /// @copydoc Field::type()
     auto valueType() const noexcept -> const std::type_info& override;
 
-    // Comparison
-    friend auto operator==<T, Serializer>(const ValueField<T, Serializer>& lhs, const ValueField<T, Serializer>& rhs) -> bool;
-    friend auto operator==<T, Serializer>(const ValueField<T, Serializer>& lhs, const T& rhs) -> bool;
-
 protected:
     T m_value{};
 };
 
+/**
+ * @class   ValueField
+ * @brief   Value field serialized with the serializer.
+ * @tparam  T           Stored data type.
+ * @tparam  Serializer  Serializer of the value.
+ * @since   0.1.0
+ */
+
 template<typename T, typename Serializer>
-inline ValueField<T, Serializer>::ValueField(const ValueField& other)
+class ValueField : public ValueField<T, void>
+{
+    using Base = ValueField<T, void>;
+
+public:
+    using Base::Base;
+    explicit ValueField(const ValueField& other) = default;
+
+public:
+    using Base::operator=;
+
+    auto serialize(SerializationContext& context) const -> void override;
+    auto deserialize(SerializationContext& context) -> void override;
+    auto serializedSize() const noexcept -> std::size_t override;
+
+    auto clone() const noexcept -> Field::Ptr override;
+
+    /// @copydoc Field::cloneAt()
+    auto cloneAt(void* storage) const -> Field* override;
+};
+
+template<typename T>
+inline ValueField<T, void>::ValueField(const ValueField& other)
     : Field(other)
     , m_value(other.m_value)
 {}
 
-template<typename T, typename Serializer>
-inline auto ValueField<T, Serializer>::ref() noexcept -> T&
+template<typename T>
+inline auto ValueField<T, void>::ref() noexcept -> T&
 {
     return m_value;
 }
 
-template<typename T, typename Serializer>
-inline auto ValueField<T, Serializer>::cref() const noexcept -> const T&
+template<typename T>
+inline auto ValueField<T, void>::cref() const noexcept -> const T&
 {
     return m_value;
 }
 
-template<typename T, typename Serializer>
-inline auto ValueField<T, Serializer>::get() const noexcept -> T
+template<typename T>
+inline auto ValueField<T, void>::get() const noexcept -> T
 {
     return m_value;
 }
 
-template<typename T, typename Serializer>
-inline auto ValueField<T, Serializer>::set(const T& other) noexcept -> void
+template<typename T>
+inline auto ValueField<T, void>::set(const T& other) noexcept -> void
 {
     m_value = other;
 }
 
-template<typename T, typename Serializer>
-inline auto ValueField<T, Serializer>::serialize(SerializationContext& context) const -> void
+template<typename T>
+auto ValueField<T, void>::isDefault() const noexcept -> bool
 {
-    Serializer::serialize(context, m_value, m_name);
+    // Values that can't be compared are always considered as set
+    if constexpr (std::equality_comparable<T>)
+        return m_value == T {};
+    else
+        return false;
 }
 
-template<typename T, typename Serializer>
-inline auto ValueField<T, Serializer>::deserialize(SerializationContext& context) -> void
+template<typename T>
+auto ValueField<T, void>::reset() -> void
 {
-    Serializer::deserialize(context, m_value, m_name);
+    m_value = T {};
 }
 
-template<typename T, typename Serializer>
-auto ValueField<T, Serializer>::serializedSize() const noexcept -> std::size_t
+template<typename T>
+auto ValueField<T, void>::equals(const Field& other) const noexcept -> bool
 {
-    return binary::size(m_value);
+    if constexpr (std::equality_comparable<T>)
+    {
+        const auto* field = dynamic_cast<const ValueField*>(&other);
+        return field and field->m_value == m_value;
+    }
+    else
+    {
+        return false;
+    }
 }
 
-template<typename T, typename Serializer>
+template<typename T>
+auto ValueField<T, void>::unowned() const noexcept -> bool
+{
+    if constexpr (IsBorrowed<T>::value)
+        return m_value.unowned();
+    else
+        return false;
+}
+
+template<typename T>
+auto ValueField<T, void>::own() -> void
+{
+    if constexpr (IsBorrowed<T>::value)
+        m_value = m_value.owned();
+}
+
+template<typename T>
 template<typename U>
-auto ValueField<T, Serializer>::operator=(U&& value) -> ValueField&
+auto ValueField<T, void>::operator=(U&& value) -> ValueField&
 {
     m_value = std::forward<U>(value);
     return *this;
 }
 
+template<typename T>
+auto ValueField<T, void>::valueType() const noexcept -> const std::type_info&
+{
+    return typeid(T);
+}
+
+template<typename T, typename Serializer>
+inline auto ValueField<T, Serializer>::serialize(SerializationContext& context) const -> void
+{
+    Serializer::serialize(context, this->m_value, *this->m_name);
+}
+
+template<typename T, typename Serializer>
+inline auto ValueField<T, Serializer>::deserialize(SerializationContext& context) -> void
+{
+    Serializer::deserialize(context, this->m_value, *this->m_name);
+}
+
+template<typename T, typename Serializer>
+auto ValueField<T, Serializer>::serializedSize() const noexcept -> std::size_t
+{
+    return binary::size(this->m_value);
+}
+
 template<typename T, typename Serializer>
 inline auto ValueField<T, Serializer>::clone() const noexcept -> Field::Ptr
 {
@@ -151,9 +237,9 @@ inline auto ValueField<T, Serializer>::clone() const noexcept -> Field::Ptr
 }
 
 template<typename T, typename Serializer>
-auto ValueField<T, Serializer>::valueType() const noexcept -> const std::type_info&
+inline auto ValueField<T, Serializer>::cloneAt(void* storage) const -> Field*
 {
-    return typeid(T);
+    return new (storage) ValueField(*this);
 }
 
 template<typename T, typename Serializer>
@@ -166,7 +252,7 @@ auto operator==(const ValueField<T, Serializer>& lhs, const ValueField<T, Serial
 template<typename T, typename Serializer>
 auto operator==(const ValueField<T, Serializer>& lhs, const T& rhs) -> bool
 {
-    return lhs.ref() == rhs;
+    return lhs.cref() == rhs;
 }
 
 } // namespace isml
@@ -7,9 +7,16 @@
 #ifndef ISML_VALUE_FIELD_DESCRIPTOR_HPP
 #define ISML_VALUE_FIELD_DESCRIPTOR_HPP
 
+#include <cstddef>
+#include <new>
+#include <tuple>
 #include <utility>
 
+#include <isml/serialization/serializers/binary_serializer.hpp>
+#include <isml/serialization/serializers/composite_serializer.hpp>
+
 #include <isml/message/field/field_descriptor.hpp>
+#include <isml/message/field/type_signature.hpp>
 #include <isml/message/field/value_field.hpp>
 
 namespace isml {
@@ -29,6 +36,24 @@ public:
     /// @copydoc FieldDescriptor::createField()
     auto createField() const noexcept -> Field::Ptr override;
 
+    /// @copydoc FieldDescriptor::constructField()
+    auto constructField(void* storage) const -> Field* override;
+
+    /// @copydoc FieldDescriptor::fieldSize()
+    auto fieldSize() const noexcept -> std::size_t override;
+
+    /// @copydoc FieldDescriptor::fieldAlignment()
+    auto fieldAlignment() const noexcept -> std::size_t override;
+
+    /// @copydoc FieldDescriptor::valueType()
+    auto valueType() const noexcept -> const std::type_info& override;
+
+    /// @copydoc FieldDescriptor::valueSignature()
+    auto valueSignature() const -> std::string override;
+
+    /// @copydoc FieldDescriptor::fixedEncoding()
+    auto fixedEncoding() const -> Maybe<FixedEncoding> override;
+
     /// @copydoc FieldDescriptor::clone()
     auto clone() const -> Ptr override;
 };
@@ -39,6 +64,62 @@ inline auto ValueFieldDescriptor<T, Serializer>::createField() const noexcept ->
     return std::make_unique<ValueField<T, Serializer>>(m_name);
 }
 
+template<typename T, typename Serializer>
+inline auto ValueFieldDescriptor<T, Serializer>::constructField(void* storage) const -> Field*
+{
+    return new (storage) ValueField<T, Serializer>(&m_name);
+}
+
+template<typename T, typename Serializer>
+auto ValueFieldDescriptor<T, Serializer>::fieldSize() const noexcept -> std::size_t
+{
+    return sizeof(ValueField<T, Serializer>);
+}
+
+template<typename T, typename Serializer>
+auto ValueFieldDescriptor<T, Serializer>::fieldAlignment() const noexcept -> std::size_t
+{
+    return alignof(ValueField<T, Serializer>);
+}
+
+template<typename T, typename Serializer>
+auto ValueFieldDescriptor<T, Serializer>::valueType() const noexcept -> const std::type_info&
+{
+    return typeid(T);
+}
+
+template<typename T, typename Serializer>
+auto ValueFieldDescriptor<T, Serializer>::valueSignature() const -> std::string
+{
+    return typeSignature<T>();
+}
+
+template<typename T, typename Serializer>
+auto ValueFieldDescriptor<T, Serializer>::fixedEncoding() const -> Maybe<FixedEncoding>
+{
+    // Binary contexts are dispatched to the binary serializer
+    constexpr auto binary = std::is_same_v<Serializer, BinarySerializer<T>>
+                         or CompositeSerializerIncludes<Serializer, BinarySerializer>::value;
+
+    Maybe<FixedEncoding> encoding { none };
+    if constexpr (binary and FixedBinaryValue<T>)
+    {
+        // The offset of the value is measured on a field created in place
+        alignas(ValueField<T, Serializer>) std::byte storage[sizeof(ValueField<T, Serializer>)];
+        auto* field = new (storage) ValueField<T, Serializer>(&m_name);
+        const auto value_offset = static_cast<std::size_t>(
+            reinterpret_cast<const std::byte*>(&field->cref()) - storage);
+        field->~ValueField();
+
+        if constexpr (IsArray<T>::value)
+            encoding = FixedEncoding { value_offset, sizeof(T), sizeof(typename T::value_type), std::tuple_size_v<T>, true };
+        else
+            encoding = FixedEncoding { value_offset, sizeof(T), sizeof(T), 1U, false };
+    }
+
+    return encoding;
+}
+
 template<typename T, typename Serializer>
 auto ValueFieldDescriptor<T, Serializer>::clone() const -> FieldDescriptor::Ptr
 {
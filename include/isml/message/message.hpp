@@ -10,20 +10,48 @@
 #include <vector>
 #include <future>
 #include <memory>
+#include <chrono>
+#include <typeinfo>
 
 #include <isml/base_types.hpp>
 
 #include <isml/message/exceptions.hpp>
 #include <isml/message/field/field.hpp>
+#include <isml/message/field/field_handle.hpp>
 #include <isml/message/field/field_set.hpp>
 #include <isml/message/field/value_field.hpp>
 
+#include <isml/net/socket_timestamping.hpp>
+
 #include <isml/serialization/serializable.hpp>
 
 namespace isml {
 
 class Session;
+class Message;
 class MessageDescriptor;
+class MessagePool;
+
+/**
+ * @class   MessageDeleter
+ * @brief   Deleter of Message::Ptr returning pooled messages to their pool.
+ */
+
+struct MessageDeleter
+{
+    auto operator()(Message* message) const noexcept -> void;
+};
+
+/**
+ * @class   MessageTimestamps
+ * @brief   Receive-side timestamps of a message, nanoseconds since the epoch.
+ */
+
+struct MessageTimestamps
+{
+    SocketTimestamp          wire     {};  ///< Kernel receive time of the frame completing the message.
+    std::chrono::nanoseconds received {};  ///< Time the message was decoded by the transport.
+};
 
 /**
  * @class   Message
@@ -32,8 +60,11 @@ class MessageDescriptor;
 
 class Message : public Serializable
 {
+    friend class MessagePool;
+    friend struct MessageDeleter;
+
 public:
-    using Ptr = std::unique_ptr<Message>;
+    using Ptr = std::unique_ptr<Message, MessageDeleter>;
     using Fields = std::vector<std::pair<std::string, Field::Ptr>>;
 
 public:
@@ -66,6 +97,31 @@ public:
     template<typename T>
     auto field(const std::string& name) -> ValueField<T>&;
 
+    /**
+     * Returns field for reading. Unlike the non-const access it never copies
+     * the fields shared with the clones of the message.
+     */
+
+    template<typename T>
+    auto field(const std::string& name) const -> const ValueField<T>&;
+
+    /**
+     * Returns the field referred to by the handle obtained from the message
+     * descriptor (see MessageDescriptor::fieldHandle). Unlike the lookup by
+     * name, neither the name is hashed nor, for a message of the layout the
+     * handle was obtained from, the type is compared.
+     *
+     * @throw   FieldDoesNotExistException - the handle refers to a field of
+     *          another message type, of another value type or of a field
+     *          registered after the message was created.
+     */
+
+    template<typename T>
+    auto field(const FieldHandle<T>& handle) -> ValueField<T>&;
+
+    template<typename T>
+    auto field(const FieldHandle<T>& handle) const -> const ValueField<T>&;
+
     /**
      * Returns the associated session.
      */
@@ -88,21 +144,112 @@ public:
 
     auto hasField(const std::string& name) const noexcept -> bool;
 
-    auto clone() const noexcept -> Message::Ptr;
+    /**
+     * Returns the logical stream the message is sent on. Messages of a stream
+     * are delivered in order, messages of different streams are interleaved
+     * by a multiplexing transport. A received message keeps the stream
+     * identifier of the sender, so a reply should be sent on the same stream.
+     */
+
+    auto streamId() const noexcept -> StreamId;
+
+    auto setStreamId(StreamId stream_id) noexcept -> void;
+
+    /**
+     * Returns receive timestamps of the message. Filled by transports with
+     * the timestamping enabled; the difference between the current time and
+     * the wire time is the time the message spent in the process.
+     */
+
+    auto timestamps() const noexcept -> const MessageTimestamps&;
+
+    auto setTimestamps(const MessageTimestamps& timestamps) noexcept -> void;
+
+    /**
+     * Creates a copy of the message sharing the fields (copy on write): the
+     * fields are copied when either message is first accessed for
+     * modification (non-const field access or deserialization), so read-only
+     * receivers of the clones, e.g. the subscribers of a channel, share a
+     * single copy. Read the fields of a shared message through a const
+     * reference (std::as_const) to keep sharing them. Unowned borrowed
+     * values are copied into the clone (see own()).
+     */
+
+    auto clone() const -> Message::Ptr;
+
+    /**
+     * Copies the borrowed values created from plain views, which refer to
+     * the bytes of the caller, into buffers of the message, so it may outlive
+     * the bytes. Transports call it for the messages queued for sending.
+     */
+
+    auto own() -> void;
 
     auto serialize(SerializationContext& context) const -> void override;
     auto deserialize(SerializationContext& context) -> void override;
 
-    auto serializedSize() const noexcept -> std::size_t;
+    auto serializedSize() const -> std::size_t;
+
+    /**
+     * Serializes the fields preceded by the table of their offsets (see
+     * FieldSet::serializeIndexed). The encoding is binary only.
+     *
+     * A message read with deserializeIndexed() retains the encoded fields
+     * and decodes each one on the first access, so the fields that are not
+     * accessed are never decoded. Accessing a field through a non-const
+     * message marks it as modified; the other fields are serialized again
+     * by copying their bytes, and a message none of whose fields is
+     * modified is written with a single copy.
+     *
+     * @throw   IOException - an accessed retained field is malformed (also
+     *          thrown by the field access).
+     */
+
+    auto serializeIndexed(SerializationContext& context) const -> void;
+    auto deserializeIndexed(SerializationContext& context) -> void;
+    auto indexedSerializedSize() const -> std::size_t;
+
+    /**
+     * Serializes the fields holding non-default values preceded by the
+     * presence bitmap (see FieldSet::serializeSparse). The encoding is
+     * binary only.
+     */
+
+    auto serializeSparse(SerializationContext& context) const -> void;
+    auto deserializeSparse(SerializationContext& context) -> void;
+    auto sparseSerializedSize() const -> std::size_t;
+
+    /**
+     * Serializes the fields differing from the base message of the same type
+     * preceded by the change bitmap (see FieldSet::serializeDelta). The
+     * receiver applies the changes to its copy of the base message.
+     */
+
+    auto serializeDelta(SerializationContext& context, const Message& base) const -> void;
+    auto deserializeDelta(SerializationContext& context) -> void;
+    auto deltaSerializedSize(const Message& base) const -> std::size_t;
 
 protected:
     auto sessionId() const noexcept -> SessionId;
 
+    /// Checks the handle of another layout refers to a field of the value
+    /// type, throws FieldDoesNotExistException otherwise.
+    auto checkHandle(MessageType message_type, std::size_t index, const std::type_info& value_type) const -> void;
+
+    /// Prepares a released message for reuse by the pool.
+    auto recycle() -> void;
+
+    /// Gives a recycled message a new identifier and the session.
+    auto renew(std::shared_ptr<Session> session) noexcept -> void;
+
 protected:
-    MessageId                m_id;
-    MessageType              m_type;
-    FieldSet                 m_fieldset;
-    std::shared_ptr<Session> m_session;
+    MessageId                    m_id;
+    MessageType                  m_type;
+    FieldSet                     m_fieldset;
+    std::shared_ptr<Session>     m_session;
+    StreamId                     m_stream_id  {};
+    MessageTimestamps            m_timestamps {};
+    std::shared_ptr<MessagePool> m_pool       {};  ///< Pool the message returns to (not copied).
 };
 
 template<typename T>
@@ -114,6 +261,33 @@ auto Message::field(const std::string& name) -> ValueField<T>&
     throw FieldDoesNotExistException("Message doesn't contain specified field", name, sessionId(), m_id);
 }
 
+template<typename T>
+auto Message::field(const std::string& name) const -> const ValueField<T>&
+{
+    if (auto maybe_field = m_fieldset.get<T>(name))
+        return maybe_field.value();
+
+    throw FieldDoesNotExistException("Message doesn't contain specified field", name, sessionId(), m_id);
+}
+
+template<typename T>
+auto Message::field(const FieldHandle<T>& handle) -> ValueField<T>&
+{
+    if (handle.layout() != m_fieldset.layout()) [[unlikely]]
+        checkHandle(handle.messageType(), handle.index(), typeid(T));
+
+    return static_cast<ValueField<T>&>(m_fieldset.at(handle.index()));
+}
+
+template<typename T>
+auto Message::field(const FieldHandle<T>& handle) const -> const ValueField<T>&
+{
+    if (handle.layout() != m_fieldset.layout()) [[unlikely]]
+        checkHandle(handle.messageType(), handle.index(), typeid(T));
+
+    return static_cast<const ValueField<T>&>(m_fieldset.at(handle.index()));
+}
+
 using FutureMessage = std::future<Message::Ptr>;
 
 } // namespace isml
@@ -7,11 +7,15 @@
 #ifndef ISML_MESSAGE_DESCRIPTOR_HPP
 #define ISML_MESSAGE_DESCRIPTOR_HPP
 
-#include <list>
-#include <unordered_map>
+#include <string>
+#include <typeinfo>
+
+#include <isml/exceptions.hpp>
 
 #include <isml/message/exceptions.hpp>
 #include <isml/message/field/field_descriptor.hpp>
+#include <isml/message/field/field_handle.hpp>
+#include <isml/message/field/field_layout.hpp>
 #include <isml/message/field/value_field_descriptor.hpp>
 
 namespace isml {
@@ -20,13 +24,20 @@ namespace isml {
  * @class   MessageDescriptor
  * @brief   Contains descriptors for creating all necessary fields in a message
  *          of specified type.
+ *
+ *          The fields are kept in a FieldLayout which is rebuilt on every
+ *          registration. Copies of the descriptor and the messages created
+ *          from it share the layout.
+ *
+ *          Messages whose fields are all trivially copyable values of a fixed
+ *          size are binary encoded by copying the values at the offsets
+ *          precomputed by the layout (see FieldLayout::fixed()).
  */
 
 class MessageDescriptor
 {
 public:
-    using FieldDescriptors = std::list<FieldDescriptor::Ptr>;
-    using FieldDescriptorsByName = std::unordered_map<std::string, FieldDescriptors::iterator>;
+    using FieldDescriptors = FieldLayout::Descriptors;
 
 public:
     MessageDescriptor() = delete;
@@ -59,6 +70,27 @@ public:
     /// Gets a field descriptor list.
     auto fieldDescriptors() const noexcept -> const FieldDescriptors&;
 
+    /// Gets the layout of the message fields.
+    auto layout() const noexcept -> const FieldLayout::Ptr&;
+
+    /// Gets the constant size of the binary encoding of the message fields
+    /// or none if a field is of a variable size.
+    auto fixedSerializedSize() const noexcept -> Maybe<std::size_t>;
+
+    /**
+     * @brief   Creates a handle to access the field of the messages of the
+     *          type without a lookup by name (see Message::field()).
+     *
+     * @tparam  T     Value type.
+     * @param   name  Field name.
+     *
+     * @throw   InvalidArgumentException  If there is no field with the name.
+     * @throw   InvalidCastException      If the field has another value type.
+     */
+
+    template<typename T>
+    auto fieldHandle(const std::string& name) const -> FieldHandle<T>;
+
     /// Swap.
     auto swap(MessageDescriptor& other) noexcept -> void;
 
@@ -69,9 +101,8 @@ protected:
     auto addFieldDescriptor(FieldDescriptor::Ptr descriptor) -> void;
 
 protected:
-    MessageType             m_type;
-    FieldDescriptors        m_field_descriptors         {};
-    FieldDescriptorsByName  m_field_descriptors_by_name {};
+    MessageType      m_type;
+    FieldLayout::Ptr m_layout;
 };
 
 template<typename Serializer, typename T>
@@ -82,6 +113,19 @@ inline auto MessageDescriptor::registerField(std::string name) -> MessageDescrip
     return *this;
 }
 
+template<typename T>
+auto MessageDescriptor::fieldHandle(const std::string& name) const -> FieldHandle<T>
+{
+    const auto index = m_layout->indexOf(name);
+    if (index.isNone())
+        throw InvalidArgumentException("Message descriptor doesn't contain field " + name);
+
+    if (m_layout->descriptors()[*index]->valueType() != typeid(T))
+        throw InvalidCastException("Field " + name + " has another value type");
+
+    return FieldHandle<T> { m_type, *index, m_layout };
+}
+
 } // namespace isml
 
 #endif // ISML_MESSAGE_DESCRIPTOR_HPP
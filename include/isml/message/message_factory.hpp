@@ -7,12 +7,20 @@
 #ifndef ISML_MESSAGE_FACTORY_HPP
 #define ISML_MESSAGE_FACTORY_HPP
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <isml/base_types.hpp>
 
+#include <isml/base/maybe.hpp>
+
 #include <isml/message/message.hpp>
 #include <isml/message/message_descriptor.hpp>
+#include <isml/message/message_pool.hpp>
 
 namespace isml {
 
@@ -21,12 +29,28 @@ class Session;
 /**
  * @class  MessageFactory
  * @brief  A factory for creating messages.
+ *
+ *         Once the message types are registered the registry may be frozen
+ *         (see freeze()). A frozen factory looks message types up in a table
+ *         indexed by the type, which is read without the registry lock, so
+ *         messages can be created on any thread while new types are still
+ *         registered.
  */
 
 class MessageFactory final
 {
 protected:
     using Descriptors = std::unordered_map<MessageType, MessageDescriptor>;
+    using Pools = std::unordered_map<MessageType, MessagePool::Ptr>;
+
+    /// Registration of a message type in the frozen table.
+    struct Entry
+    {
+        const MessageDescriptor* descriptor {};  ///< Refers to a node of the descriptor map.
+        MessagePool::Ptr         pool       {};  ///< Keeps the pool alive while the table is readable.
+    };
+
+    using Table = std::vector<Entry>;
 
 public:
     MessageFactory() = default;
@@ -60,25 +84,108 @@ public:
 
     auto createMessage(MessageType type, Session& session) -> Message::Ptr;
 
+    /**
+     * @brief   Creates message instance by message type if the type is
+     *          registered. Unlike hasDescriptor() followed by createMessage()
+     *          the type is looked up once.
+     *
+     * @return  Pointer to message or an empty pointer if the message type is
+     *          not registered.
+     */
+
+    auto tryCreateMessage(MessageType type, Session& session) -> Message::Ptr;
+
     /**
      * @brief   Adds a new message descriptor.
      *
      * @param   descriptor  Message descriptor.
      *
-     * @return  If successful - true, otherwise - false.
+     * @return  If successful - true, otherwise - false (the type is
+     *          registered or reserved, see k_reserved_msg_type).
+     *
+     * @throw   std::bad_alloc - will be thrown if the descriptor or its pool
+     *          cannot be allocated.
      */
 
-    auto addDescriptor(MessageDescriptor descriptor) noexcept -> bool;
+    auto addDescriptor(MessageDescriptor descriptor) -> bool;
 
     template<typename ConfigureDescriptor>
     auto addDescriptor(MessageType type, ConfigureDescriptor&& configure) -> bool;
 
     auto hasDescriptor(MessageType type) const noexcept -> bool;
 
+    /**
+     * @brief   Creates a handle to access the field of the messages of the
+     *          type (see MessageDescriptor::fieldHandle).
+     *
+     * @throw   UnknownMessageTypeException - message type is not registered.
+     */
+
+    template<typename T>
+    auto fieldHandle(MessageType type, const std::string& name) const -> FieldHandle<T>;
+
+    /**
+     * @brief   Enables recycling of the messages of each registered type
+     *          (see MessagePool). Must be called before messages are created.
+     *
+     * @param   capacity  Maximum number of idle messages of a type kept by
+     *                    each thread; 0 disables the pools.
+     */
+
+    auto setPoolCapacity(std::size_t capacity) -> void;
+
+    /// Gets the pool of the message type if the pools are enabled. The pool
+    /// may be freed once setPoolCapacity changes the capacity.
+    auto pool(MessageType type) const noexcept -> Maybe<MessagePool&>;
+
+    /**
+     * @brief   Compiles the registered descriptors into a read-only table
+     *          indexed by the message type. The lookups of a frozen factory
+     *          (createMessage, tryCreateMessage, hasDescriptor, fieldHandle
+     *          and pool) are a single atomic load of the shared table and
+     *          don't take the registry lock.
+     *
+     *          Later calls of addDescriptor and setPoolCapacity are
+     *          serialized and publish a new table; the lookups running
+     *          concurrently keep reading the previous one, which is freed
+     *          once the last of them is done with it.
+     *
+     *          Copying, moving and swapping the factory are not thread-safe.
+     */
+
+    auto freeze() -> void;
+
+    /// Checks if the registry is compiled into the lookup table.
+    auto frozen() const noexcept -> bool;
+
+    /**
+     * @brief   Computes a hash of the registered message types and their
+     *          field names and value types (see typeSignature()) in the
+     *          registration order. Peers having the same fingerprint use the
+     *          same message layouts, whatever their byte order.
+     */
+
+    auto fingerprint() const -> std::uint64_t;
+
     auto swap(MessageFactory& other) noexcept -> void;
 
 protected:
-    Descriptors m_descriptors {}; ///< Message descriptors.
+    /// Finds the descriptor of the message type, nullptr if it is not registered.
+    auto findDescriptor(MessageType type) const noexcept -> const MessageDescriptor*;
+
+    /// Creates the missing pools of the registered types and replaces the
+    /// ones of another capacity, m_mutex must be held.
+    auto createPools() -> void;
+
+    /// Builds and publishes the lookup table, m_mutex must be held.
+    auto publish() -> void;
+
+protected:
+    Descriptors                                m_descriptors   {}; ///< Message descriptors.
+    Pools                                      m_pools         {}; ///< Message pools by type, if enabled.
+    std::size_t                                m_pool_capacity {};
+    std::atomic<std::shared_ptr<const Table>>  m_table         {}; ///< Current lookup table, null until frozen; readers share the one they loaded.
+    mutable std::mutex                         m_mutex         {}; ///< Serializes the registrations.
 };
 
 template<typename ConfigureDescriptor>
@@ -89,6 +196,16 @@ auto MessageFactory::addDescriptor(MessageType type, ConfigureDescriptor&& confi
     return addDescriptor(std::move(descriptor));
 }
 
+template<typename T>
+auto MessageFactory::fieldHandle(MessageType type, const std::string& name) const -> FieldHandle<T>
+{
+    const auto* descriptor = findDescriptor(type);
+    if (!descriptor)
+        throw UnknownMessageTypeException("There is no registered descriptor for this message type", type);
+
+    return descriptor->fieldHandle<T>(name);
+}
+
 } // namespace isml
 
 #endif // ISML_MESSAGE_FACTORY_HPP
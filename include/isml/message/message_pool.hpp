@@ -0,0 +1,95 @@
+/**
+ * @file    message_pool.hpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#ifndef ISML_MESSAGE_POOL_HPP
+#define ISML_MESSAGE_POOL_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <isml/message/message.hpp>
+#include <isml/message/message_descriptor.hpp>
+
+namespace isml {
+
+class Session;
+
+/**
+ * @class   MessagePoolStatistics
+ * @brief   Counters of a message pool. Safe to read from any thread.
+ * @since   0.1.7
+ */
+
+struct MessagePoolStatistics
+{
+    using Counter = std::atomic<std::uint64_t>;
+
+    Counter hits      {};  ///< Messages taken from a free list.
+    Counter misses    {};  ///< Messages allocated as the free list was empty.
+    Counter discarded {};  ///< Released messages freed as the free list was full.
+};
+
+/**
+ * @class   MessagePool
+ * @brief   Recycles the messages of one type. A message created by the pool
+ *          returns to it when its Message::Ptr is destroyed: the fields are
+ *          reset to the default values in place and the message is put to
+ *          the free list of the releasing thread, so creating a message on
+ *          the same thread again takes neither an allocation nor a
+ *          construction of the fields. Each thread keeps at most capacity()
+ *          idle messages of the pool; the rest are freed.
+ *
+ *          Idle messages keep the pool alive. They are freed when their
+ *          thread exits or on trim().
+ * @since   0.1.7
+ */
+
+class MessagePool final : public std::enable_shared_from_this<MessagePool>
+{
+public:
+    using Ptr = std::shared_ptr<MessagePool>;
+
+public:
+    MessagePool() = delete;
+    MessagePool(MessageDescriptor descriptor, std::size_t capacity);
+
+    // non-copyable
+    MessagePool(const MessagePool&) = delete;
+    auto operator=(const MessagePool&) -> MessagePool& = delete;
+
+public:
+
+    /**
+     * @brief   Takes a message from the free list of the current thread or
+     *          creates a new one. The message holds the default values.
+     *
+     * @param   session  Session the message belongs to.
+     */
+
+    auto acquire(std::shared_ptr<Session> session) -> Message::Ptr;
+
+    /// Returns the message to the free list of the current thread (called by MessageDeleter).
+    auto release(Message* message) noexcept -> void;
+
+    /// Frees the idle messages of the current thread.
+    auto trim() noexcept -> void;
+
+    /// Gets the maximum number of idle messages per thread.
+    auto capacity() const noexcept -> std::size_t;
+
+    auto statistics() const noexcept -> const MessagePoolStatistics&;
+
+protected:
+    MessageDescriptor     m_descriptor;
+    std::size_t           m_capacity;
+    MessagePoolStatistics m_statistics {};
+};
+
+} // namespace isml
+
+#endif // ISML_MESSAGE_POOL_HPP
@@ -0,0 +1,67 @@
+/**
+ * @file    socket_error_queue.hpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#ifndef ISML_SOCKET_ERROR_QUEUE_HPP
+#define ISML_SOCKET_ERROR_QUEUE_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include <isml/net/socket_timestamping.hpp>
+
+namespace isml {
+
+/**
+ * @class   ZeroCopyCompletion
+ * @brief   Range of zero-copy send calls (inclusive) the kernel is done with.
+ */
+
+struct ZeroCopyCompletion
+{
+    std::uint32_t first  {};
+    std::uint32_t last   {};
+    bool          copied {};  ///< The kernel fell back to copying the data.
+};
+
+/**
+ * @class   SocketNotifications
+ * @brief   Notifications read from the socket error queue.
+ */
+
+struct SocketNotifications
+{
+    std::vector<TransmitTimestamp>  transmitted {};
+    std::vector<ZeroCopyCompletion> zero_copy   {};
+};
+
+/**
+ * @class   SocketErrorQueue
+ * @brief   Reads the socket error queue (MSG_ERRQUEUE) shared by the transmit
+ *          timestamps and the zero-copy completions.
+ * @since   0.1.7
+ */
+
+class SocketErrorQueue
+{
+public:
+    using NativeHandle = int;
+
+public:
+
+    /**
+     * @brief   Drains the error queue without blocking.
+     *
+     * @param   fd  Native socket handle.
+     *
+     * @return  Notifications in the order they were reported.
+     */
+
+    static auto read(NativeHandle fd) -> SocketNotifications;
+};
+
+} // namespace isml
+
+#endif // ISML_SOCKET_ERROR_QUEUE_HPP
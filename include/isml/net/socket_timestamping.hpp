@@ -0,0 +1,117 @@
+/**
+ * @file    socket_timestamping.hpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#ifndef ISML_SOCKET_TIMESTAMPING_HPP
+#define ISML_SOCKET_TIMESTAMPING_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+
+#include <isml/base/result.hpp>
+
+struct cmsghdr;
+
+namespace isml {
+
+/**
+ * @class   SocketTimestamp
+ * @brief   Time a packet passed the network stack (software) or the network
+ *          adapter (hardware). Both are nanoseconds since the epoch, zero if
+ *          the corresponding source is not available.
+ * @since   0.1.7
+ */
+
+struct SocketTimestamp
+{
+    std::chrono::nanoseconds software {};
+    std::chrono::nanoseconds hardware {};
+
+    explicit operator bool() const noexcept
+    {
+        return software.count() or hardware.count();
+    }
+};
+
+/**
+ * @class   TransmitTimestamp
+ * @brief   Transmit timestamp read from the socket error queue.
+ *
+ *          For stream sockets the key is the offset of the last byte of the
+ *          transmitted data in the stream, for datagram sockets it is the
+ *          sequence number of the datagram.
+ */
+
+struct TransmitTimestamp
+{
+    std::uint32_t   key       {};
+    SocketTimestamp timestamp {};
+};
+
+/**
+ * @class   SocketTimestamping
+ * @brief   Socket-agnostic access to the kernel timestamping (SO_TIMESTAMPING),
+ *          usable for stream and datagram sockets. Transmit timestamps are
+ *          read from the socket error queue (see SocketErrorQueue).
+ *
+ * @note    Hardware timestamps are reported only if the timestamping is
+ *          configured on the network interface (SIOCSHWTSTAMP).
+ * @since   0.1.7
+ */
+
+class SocketTimestamping
+{
+public:
+    using NativeHandle = int;
+
+    enum class Source
+    {
+        Software,
+        Hardware
+    };
+
+public:
+
+    /**
+     * @brief   Enables RX and TX timestamps on the socket.
+     *
+     * @param   fd      Native socket handle.
+     * @param   source  Timestamp source.
+     *
+     * @return  Error code (empty on success).
+     */
+
+    static auto enable(NativeHandle fd, Source source) noexcept -> std::error_code;
+
+    /**
+     * @brief   Receives available data without blocking.
+     *
+     * @param   fd         Native socket handle.
+     * @param   data       Destination buffer.
+     * @param   size       Buffer size.
+     * @param   timestamp  Receive timestamp of the data (left untouched if the
+     *                     kernel doesn't report it).
+     *
+     * @return  If successful - number of bytes received (0 if the peer closed
+     *          the connection), otherwise - error code.
+     */
+
+    static auto receive(NativeHandle fd, void* data, std::size_t size, SocketTimestamp& timestamp) noexcept
+        -> Result<std::size_t, std::error_code>;
+
+    /**
+     * @brief   Extracts the timestamp from a control message.
+     *
+     * @return  If the message is a timestamp - true, otherwise - false.
+     */
+
+    static auto parse(const cmsghdr* cmsg, SocketTimestamp& timestamp) noexcept -> bool;
+};
+
+} // namespace isml
+
+#endif // ISML_SOCKET_TIMESTAMPING_HPP
@@ -0,0 +1,50 @@
+/**
+ * @file    socket_zero_copy.hpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#ifndef ISML_SOCKET_ZERO_COPY_HPP
+#define ISML_SOCKET_ZERO_COPY_HPP
+
+#include <cstddef>
+#include <system_error>
+
+#include <isml/base/result.hpp>
+
+namespace isml {
+
+/**
+ * @class   SocketZeroCopy
+ * @brief   Zero-copy transmission (SO_ZEROCOPY/MSG_ZEROCOPY).
+ *
+ *          The kernel pins the pages of the sent data instead of copying it,
+ *          so the data must stay untouched until the kernel reports the
+ *          completion of the send call through the socket error queue (see
+ *          SocketErrorQueue). Successful send calls are numbered from zero,
+ *          the completions refer to these numbers.
+ * @since   0.1.7
+ */
+
+class SocketZeroCopy
+{
+public:
+    using NativeHandle = int;
+
+public:
+    static auto enable(NativeHandle fd) noexcept -> std::error_code;
+
+    /**
+     * @brief   Sends data without blocking.
+     *
+     * @return  If successful - number of bytes sent, otherwise - error code
+     *          (ENOBUFS if the kernel can't pin more pages for the socket).
+     */
+
+    static auto send(NativeHandle fd, const void* data, std::size_t size) noexcept
+        -> Result<std::size_t, std::error_code>;
+};
+
+} // namespace isml
+
+#endif // ISML_SOCKET_ZERO_COPY_HPP
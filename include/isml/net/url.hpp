@@ -8,16 +8,18 @@
 #define ISML_URL_HPP
 
 #include <string>
-#include <unordered_map>
+#include <map>
 #include <type_traits>
 #include <regex>
 
+#include <isml/base/maybe.hpp>
+
 namespace isml {
 
 class Url
 {
 public:
-    using Parameters = std::unordered_map<std::string, std::string>;
+    using Parameters = std::map<std::string, std::string>;
 
 public:
     Url() = default;
@@ -36,6 +38,18 @@ public:
 
     auto addParameter(const std::string& name, const std::string& value) -> Url&;
 
+    /**
+     * @brief   Gets the value of the query parameter.
+     *
+     * @param   name  Parameter name.
+     *
+     * @return  If the parameter is present - its value, otherwise - none.
+     */
+
+    auto parameter(const std::string& name) const -> Maybe<std::string>;
+
+    auto parameters() const noexcept -> const Parameters&;
+
     auto toString() const noexcept -> std::string;
 
     static auto parse(const std::string& str) -> Url;
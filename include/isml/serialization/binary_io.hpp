@@ -0,0 +1,254 @@
+/**
+ * @file    binary_io.hpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#ifndef ISML_BINARY_IO_HPP
+#define ISML_BINARY_IO_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <utility>
+
+#include <isml/utility/shared_buffer.hpp>
+
+namespace isml {
+
+/**
+ * @class   BinaryWriter
+ * @brief   Writes bytes to a contiguous buffer. The buffer is either owned by
+ *          the writer and grows as needed, or provided by the caller, in
+ *          which case writing past its end throws IOException.
+ * @since   0.1.7
+ */
+
+class BinaryWriter
+{
+public:
+    BinaryWriter() = default;
+    explicit BinaryWriter(std::span<char> buffer) noexcept;
+
+    // non-copyable
+    BinaryWriter(const BinaryWriter&) = delete;
+    auto operator=(const BinaryWriter&) -> BinaryWriter& = delete;
+
+public:
+    auto write(const void* data, std::size_t size) -> void;
+
+    /// Appends the given number of uninitialized bytes and gets them to be filled in.
+    auto extend(std::size_t size) -> char*;
+
+    /// Replaces the written bytes starting at the position, e.g. a header reserved before the body.
+    auto overwrite(std::size_t position, const void* data, std::size_t size) -> void;
+
+    /// Gets the written bytes.
+    auto data() const noexcept -> const char*;
+    auto size() const noexcept -> std::size_t;
+    auto view() const noexcept -> std::string_view;
+
+    auto capacity() const noexcept -> std::size_t;
+
+    /// Discards the written bytes keeping the buffer.
+    auto clear() noexcept -> void;
+
+protected:
+    auto grow(std::size_t required) -> void;
+
+    [[noreturn]] static auto throwOutOfRange() -> void;
+
+protected:
+    std::unique_ptr<char[]> m_storage  {};  ///< Empty if the buffer is external.
+    char*                   m_data     {};
+    std::size_t             m_capacity {};
+    std::size_t             m_size     {};
+    bool                    m_external {};
+};
+
+/**
+ * @class   BinaryReader
+ * @brief   Reads bytes from a contiguous buffer owned by the caller. Reading
+ *          past its end throws IOException.
+ *
+ *          A reader of a shared buffer (the backing buffer) lets the decoded
+ *          values refer to the bytes instead of copying them (see
+ *          takeShared()).
+ * @since   0.1.7
+ */
+
+class BinaryReader
+{
+public:
+    BinaryReader() = delete;
+    explicit BinaryReader(std::span<const char> data) noexcept;
+    explicit BinaryReader(std::string_view data) noexcept;
+
+    /// Reads the bytes of the shared buffer, which must outlive the reader.
+    explicit BinaryReader(const SharedBuffer& buffer) noexcept;
+
+    /// Reads the bytes lying within the backing buffer.
+    BinaryReader(std::string_view data, const SharedBuffer& backing) noexcept;
+
+    // non-copyable
+    BinaryReader(const BinaryReader&) = delete;
+    auto operator=(const BinaryReader&) -> BinaryReader& = delete;
+
+public:
+    auto read(void* data, std::size_t size) -> void;
+
+    /**
+     * @brief   Takes the given number of bytes without copying them.
+     *
+     * @return  View of the bytes, valid as long as the underlying buffer.
+     */
+
+    auto take(std::size_t size) -> std::string_view;
+
+    /// Gets the given number of bytes without advancing the cursor.
+    auto peek(std::size_t size) const -> std::string_view;
+
+    /**
+     * @brief   Takes the given number of bytes along with a reference to the
+     *          buffer holding them: the backing buffer or, if there is none,
+     *          a new buffer the bytes are copied to.
+     *
+     * @return  Buffer and the view of the bytes, valid as long as the buffer.
+     */
+
+    auto takeShared(std::size_t size) -> std::pair<SharedBuffer, std::string_view>;
+
+    auto skip(std::size_t size) -> void;
+
+    auto position() const noexcept -> std::size_t;
+    auto remaining() const noexcept -> std::size_t;
+
+    /// Gets the buffer the bytes lie within or nullptr.
+    auto backing() const noexcept -> const SharedBuffer*;
+
+protected:
+    auto require(std::size_t size) const -> void;
+
+    [[noreturn]] static auto throwEndOfData() -> void;
+
+protected:
+    const char*         m_data     {};
+    std::size_t         m_size     {};
+    std::size_t         m_position {};
+    const SharedBuffer* m_backing  {};
+};
+
+// Definitions
+
+inline auto BinaryWriter::write(const void* data, std::size_t size) -> void
+{
+    if (size > m_capacity - m_size)
+        grow(m_size + size);
+
+    if (size)
+        std::memcpy(m_data + m_size, data, size);
+
+    m_size += size;
+}
+
+inline auto BinaryWriter::extend(std::size_t size) -> char*
+{
+    if (size > m_capacity - m_size)
+        grow(m_size + size);
+
+    auto* bytes = m_data + m_size;
+    m_size += size;
+    return bytes;
+}
+
+inline auto BinaryWriter::overwrite(std::size_t position, const void* data, std::size_t size) -> void
+{
+    if (position > m_size or size > m_size - position)
+        throwOutOfRange();
+
+    if (size)
+        std::memcpy(m_data + position, data, size);
+}
+
+inline auto BinaryWriter::data() const noexcept -> const char*
+{
+    return m_data;
+}
+
+inline auto BinaryWriter::size() const noexcept -> std::size_t
+{
+    return m_size;
+}
+
+inline auto BinaryWriter::view() const noexcept -> std::string_view
+{
+    return { m_data, m_size };
+}
+
+inline auto BinaryWriter::capacity() const noexcept -> std::size_t
+{
+    return m_capacity;
+}
+
+inline auto BinaryWriter::clear() noexcept -> void
+{
+    m_size = 0U;
+}
+
+inline auto BinaryReader::require(std::size_t size) const -> void
+{
+    if (size > m_size - m_position)
+        throwEndOfData();
+}
+
+inline auto BinaryReader::read(void* data, std::size_t size) -> void
+{
+    require(size);
+
+    if (size)
+        std::memcpy(data, m_data + m_position, size);
+
+    m_position += size;
+}
+
+inline auto BinaryReader::take(std::size_t size) -> std::string_view
+{
+    require(size);
+
+    const std::string_view bytes { m_data + m_position, size };
+    m_position += size;
+    return bytes;
+}
+
+inline auto BinaryReader::peek(std::size_t size) const -> std::string_view
+{
+    require(size);
+    return { m_data + m_position, size };
+}
+
+inline auto BinaryReader::skip(std::size_t size) -> void
+{
+    require(size);
+    m_position += size;
+}
+
+inline auto BinaryReader::position() const noexcept -> std::size_t
+{
+    return m_position;
+}
+
+inline auto BinaryReader::remaining() const noexcept -> std::size_t
+{
+    return m_size - m_position;
+}
+
+inline auto BinaryReader::backing() const noexcept -> const SharedBuffer*
+{
+    return m_backing;
+}
+
+} // namespace isml
+
+#endif // ISML_BINARY_IO_HPP
@@ -0,0 +1,319 @@
+/**
+ * @file    json_io.hpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#ifndef ISML_JSON_IO_HPP
+#define ISML_JSON_IO_HPP
+
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include <isml/exceptions.hpp>
+
+#include <isml/serialization/binary_io.hpp>
+
+namespace isml {
+
+/**
+ * @class   JsonWriter
+ * @brief   Writes JSON text straight to a growable buffer, without building
+ *          a document tree. The writer tracks the nesting of objects and
+ *          arrays and places the member names and the separators itself:
+ *          every value is preceded by key(), which writes the name inside an
+ *          object and only the separator inside an array or at top level.
+ * @since   0.1.7
+ */
+
+class JsonWriter
+{
+public:
+    JsonWriter() = default;
+
+    // non-copyable
+    JsonWriter(const JsonWriter&) = delete;
+    auto operator=(const JsonWriter&) -> JsonWriter& = delete;
+
+public:
+
+    /// Starts a value, writing the separator and the member name if needed.
+    auto key(std::string_view name) -> void;
+
+    auto beginObject() -> void;
+    auto endObject() -> void;
+    auto beginArray() -> void;
+    auto endArray() -> void;
+
+    auto writeNull() -> void;
+    auto writeBool(bool value) -> void;
+    auto writeString(std::string_view value) -> void;
+
+    template<typename T>
+    auto writeInteger(T value) -> void;
+
+    /// Writes the shortest representation; non-finite values are written as null.
+    template<typename T>
+    auto writeFloat(T value) -> void;
+
+    /// Gets the written text.
+    auto data() const noexcept -> const char*;
+    auto size() const noexcept -> std::size_t;
+    auto view() const noexcept -> std::string_view;
+
+    /// Discards the written text keeping the buffer.
+    auto clear() noexcept -> void;
+
+protected:
+    auto put(char c) -> void;
+    auto put(std::string_view text) -> void;
+
+protected:
+    struct Scope
+    {
+        bool object; ///< Object or array.
+        bool first;  ///< No value has been written yet.
+    };
+
+    BinaryWriter       m_buffer {};
+    std::vector<Scope> m_scopes {};
+};
+
+/**
+ * @class   JsonReader
+ * @brief   Pull parser over JSON text owned by the caller. Values are read in
+ *          the order the caller asks for them. Inside an object member()
+ *          positions the cursor at the value of the named member: members
+ *          written in the same order are found without a search, others are
+ *          looked up from the beginning of the object. Malformed text and
+ *          missing members throw IOException.
+ * @since   0.1.7
+ */
+
+class JsonReader
+{
+public:
+    JsonReader() = delete;
+    explicit JsonReader(std::string_view json) noexcept;
+
+    // non-copyable
+    JsonReader(const JsonReader&) = delete;
+    auto operator=(const JsonReader&) -> JsonReader& = delete;
+
+public:
+
+    /// Moves to the value of the named member. Does nothing outside an object.
+    auto member(std::string_view name) -> void;
+
+    /**
+     * @brief   Reads the name of the next member of the current object.
+     *
+     * @return  false if there are no members left.
+     */
+
+    auto nextMember(std::string& name) -> bool;
+
+    auto beginObject() -> void;
+
+    /// Skips the remaining members and leaves the object.
+    auto endObject() -> void;
+
+    auto beginArray() -> void;
+
+    /**
+     * @brief   Moves to the next item of the current array.
+     *
+     * @return  false if there are no items left.
+     */
+
+    auto nextItem() -> bool;
+
+    auto endArray() -> void;
+
+    /// Reads null if it is the next value.
+    auto readNull() -> bool;
+    auto readBool() -> bool;
+    auto readString(std::string& value) -> void;
+
+    template<typename T>
+    auto readInteger() -> T;
+
+    /// Reads a number; null is read as NaN.
+    template<typename T>
+    auto readFloat() -> T;
+
+    auto skipValue() -> void;
+
+    auto position() const noexcept -> std::size_t;
+
+protected:
+    struct Scope
+    {
+        bool        object; ///< Object or array.
+        bool        first;  ///< The cursor is right after the opening bracket.
+        std::size_t start;  ///< Position after the opening bracket.
+    };
+
+    auto skipSpace() noexcept -> void;
+    auto peek() -> char;
+    auto expect(char c) -> void;
+    auto literal(std::string_view text) -> void;
+
+    /// Reads the next member name into m_key; false at the end of the object.
+    /// The scope is looked up on every call as skipping nested values may
+    /// reallocate the scope stack.
+    auto nextKey() -> bool;
+
+    auto readText(std::string& value) -> void;
+    auto skipText() -> void;
+
+    /// Takes the characters of a number.
+    auto number() -> std::string_view;
+
+    [[noreturn]] static auto throwMalformed() -> void;
+
+protected:
+    std::string_view   m_data     {};
+    std::size_t        m_position {};
+    std::vector<Scope> m_scopes   {};
+    std::string        m_key      {};  ///< Last member name read.
+};
+
+// Definitions
+
+inline auto JsonWriter::put(char c) -> void
+{
+    m_buffer.write(&c, 1U);
+}
+
+inline auto JsonWriter::put(std::string_view text) -> void
+{
+    m_buffer.write(text.data(), text.size());
+}
+
+inline auto JsonWriter::key(std::string_view name) -> void
+{
+    if (m_scopes.empty())
+        return;
+
+    auto& scope = m_scopes.back();
+    if (!scope.first)
+        put(',');
+    scope.first = false;
+
+    if (scope.object)
+    {
+        writeString(name);
+        put(':');
+    }
+}
+
+template<typename T>
+inline auto JsonWriter::writeInteger(T value) -> void
+{
+    char text[std::numeric_limits<T>::digits10 + 3];
+    const auto result = std::to_chars(std::begin(text), std::end(text), value);
+    m_buffer.write(text, static_cast<std::size_t>(result.ptr - text));
+}
+
+template<typename T>
+inline auto JsonWriter::writeFloat(T value) -> void
+{
+    if (!std::isfinite(value))
+    {
+        writeNull();
+        return;
+    }
+
+    char text[32];
+    const auto result = std::to_chars(std::begin(text), std::end(text), value);
+    m_buffer.write(text, static_cast<std::size_t>(result.ptr - text));
+}
+
+inline auto JsonWriter::data() const noexcept -> const char*
+{
+    return m_buffer.data();
+}
+
+inline auto JsonWriter::size() const noexcept -> std::size_t
+{
+    return m_buffer.size();
+}
+
+inline auto JsonWriter::view() const noexcept -> std::string_view
+{
+    return m_buffer.view();
+}
+
+inline auto JsonWriter::clear() noexcept -> void
+{
+    m_buffer.clear();
+    m_scopes.clear();
+}
+
+inline auto JsonReader::skipSpace() noexcept -> void
+{
+    while (m_position < m_data.size())
+    {
+        const auto c = m_data[m_position];
+        if (c != ' ' and c != '\n' and c != '\r' and c != '\t')
+            break;
+        ++m_position;
+    }
+}
+
+inline auto JsonReader::peek() -> char
+{
+    skipSpace();
+    if (m_position == m_data.size())
+        throwMalformed();
+    return m_data[m_position];
+}
+
+inline auto JsonReader::expect(char c) -> void
+{
+    if (peek() != c)
+        throwMalformed();
+    ++m_position;
+}
+
+template<typename T>
+inline auto JsonReader::readInteger() -> T
+{
+    const auto text = number();
+    T value;
+    const auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (result.ec != std::errc {} or result.ptr != text.data() + text.size())
+        throw IOException("Invalid JSON number");
+    return value;
+}
+
+template<typename T>
+inline auto JsonReader::readFloat() -> T
+{
+    if (readNull())
+        return std::numeric_limits<T>::quiet_NaN();
+
+    const auto text = number();
+    T value;
+    const auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (result.ec != std::errc {} or result.ptr != text.data() + text.size())
+        throw IOException("Invalid JSON number");
+    return value;
+}
+
+inline auto JsonReader::position() const noexcept -> std::size_t
+{
+    return m_position;
+}
+
+} // namespace isml
+
+#endif // ISML_JSON_IO_HPP
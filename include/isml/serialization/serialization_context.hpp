@@ -10,12 +10,73 @@
 #include <typeinfo>
 #include <memory>
 #include <functional>
+#include <type_traits>
 
 #include <isml/exceptions.hpp>
 #include <isml/serialization/serializer_traits.hpp>
 
 namespace isml {
 
+class StringDictionary;
+class SerializationContext;
+
+/**
+ * @class   SerializerBinding
+ * @brief   The serializer and the IO object type of a context without the IO
+ *          object. Creates contexts of the same serializer for other IO
+ *          objects, e.g. to decode data retained by a message later (see
+ *          FieldSet::deserializeIndexed).
+ * @since   0.1.7
+ */
+
+class SerializerBinding final
+{
+    friend class SerializationContext;
+
+public:
+    SerializerBinding() = delete;
+
+public:
+
+    /**
+     * @brief   Creates a (type-erased) context of the serializer for the IO
+     *          object.
+     *
+     * @tparam  Stream  IO object type, the one of the original context.
+     *
+     * @throw   InvalidCastException  If the original context has another IO
+     *          object type.
+     */
+
+    template<typename Stream>
+    auto bind(Stream& io) const -> SerializationContext;
+
+    /// Checks if the context is made for the serializer.
+    template<template<typename...> typename Serializer>
+    auto uses() const noexcept -> bool;
+
+private:
+    SerializerBinding(const std::type_info& serializer_type, const void* serializer_key, const void* io_key) noexcept;
+
+private:
+    const std::type_info* m_serializer_type;
+    const void*           m_serializer_key;
+    const void*           m_io_key;
+};
+
+/**
+ * @brief   The address of the variable identifies the type without RTTI.
+ * @since   0.1.7
+ */
+
+template<typename T>
+inline constexpr char type_key {};
+
+template<template<typename...> typename Serializer, typename Stream>
+    requires std::is_same_v<Stream, typename SerializerTraits<Serializer>::Input>
+          or std::is_same_v<Stream, typename SerializerTraits<Serializer>::Output>
+class TypedSerializationContext;
+
 /**
  * @class   SerializationContext
  * @brief   Provide details about the required serializer and give an access to
@@ -25,6 +86,8 @@ namespace isml {
 
 class SerializationContext
 {
+    friend class SerializerBinding;
+
 public:
     SerializationContext() = delete;
     SerializationContext(const SerializationContext&) = delete;
@@ -34,12 +97,51 @@ public:
     auto operator=(const SerializationContext&) -> SerializationContext& = delete;
 
 protected:
-    template<typename Stream>
-    explicit SerializationContext(const std::type_info& serializer_type, Stream& stream) noexcept;
+    template<template<typename...> typename Serializer, typename Stream>
+    SerializationContext(SerializerTag<Serializer>, Stream& stream, bool typed) noexcept;
+
+    SerializationContext(const SerializerBinding& binding, void* io) noexcept;
 
 public:
     auto serializerTag() const noexcept -> const std::type_info&;
 
+    /**
+     * @brief   Checks if the context is made for the specified serializer.
+     *          Unlike serializerTag() it doesn't involve RTTI.
+     *
+     * @tparam  Serializer  Serializer type.
+     */
+
+    template<template<typename...> typename Serializer>
+    auto uses() const noexcept -> bool;
+
+    /// Checks if the context is made for the serializer of the binding.
+    auto uses(const SerializerBinding& binding) const noexcept -> bool;
+
+    /// Checks if the IO object is of the specified type.
+    template<typename Stream>
+    auto holds() const noexcept -> bool;
+
+    /// Checks if the context is a TypedSerializationContext.
+    auto typed() const noexcept -> bool;
+
+    /// Gets the serializer and the IO object type of the context.
+    auto binding() const noexcept -> SerializerBinding;
+
+    /**
+     * @brief   Returns the context as a typed one if it is a
+     *          TypedSerializationContext of the specified serializer and
+     *          IO object type.
+     *
+     * @tparam  Serializer  Serializer type.
+     * @tparam  Stream      IO object type.
+     *
+     * @return  Typed context or nullptr.
+     */
+
+    template<template<typename...> typename Serializer, typename Stream>
+    auto typedAs() noexcept -> TypedSerializationContext<Serializer, Stream>*;
+
     /**
      * @brief   Create serialization context for the specified serializer.
      *
@@ -66,17 +168,101 @@ public:
     template<typename Stream>
     auto stream() -> Stream&;
 
+    /**
+     * @brief   Returns the dictionary used to send repeated strings as
+     *          identifiers (binary serialization only, see StringDictionary).
+     *
+     * @return  A pointer to the dictionary or nullptr if strings are written
+     *          as is.
+     */
+
+    auto dictionary() const noexcept -> StringDictionary*;
+    auto setDictionary(StringDictionary* dictionary) noexcept -> void;
+
 protected:
     std::reference_wrapper<const std::type_info> m_serializer_type;
-    std::reference_wrapper<const std::type_info> m_io_type;
+    const void*                                  m_serializer_key;
+    const void*                                  m_io_key;
     void*                                        m_io;
+    bool                                         m_typed;
+    StringDictionary*                            m_dictionary {};
 };
 
-template<typename Object>
-inline SerializationContext::SerializationContext(const std::type_info& serializer_type, Object& io) noexcept
-    : m_serializer_type(serializer_type)
-    , m_io_type(typeid(Object))
+/**
+ * @brief   A serialization context type.
+ * @since   0.1.7
+ */
+
+template<typename T>
+concept SerializationContextType = std::is_base_of_v<SerializationContext, T>;
+
+/**
+ * @class   TypedSerializationContext
+ * @brief   Serialization context knowing the serializer and the IO object type
+ *          at compile time.
+ *
+ *          Serializers are templated on the context type, so everything
+ *          encoded through this context (including nested values) is
+ *          dispatched statically and the IO object is accessed without checks.
+ *          It is still a SerializationContext and can be passed to
+ *          type-erased interfaces: a CompositeSerializer recognizes it with a
+ *          single comparison and continues with the static dispatch.
+ *
+ * @tparam  Serializer  Serializer type.
+ * @tparam  Stream      IO object type.
+ * @since   0.1.7
+ */
+
+template<template<typename...> typename Serializer, typename Stream>
+    requires std::is_same_v<Stream, typename SerializerTraits<Serializer>::Input>
+          or std::is_same_v<Stream, typename SerializerTraits<Serializer>::Output>
+class TypedSerializationContext final : public SerializationContext
+{
+public:
+    using Tag = SerializerTag<Serializer>;
+
+    template<typename T>
+    using SerializerFor = Serializer<T>;
+
+public:
+    explicit TypedSerializationContext(Stream& io) noexcept
+        : SerializationContext(SerializerTag<Serializer> {}, io, true)
+        , m_stream(io)
+    {}
+
+    /// @copydoc SerializationContext::stream()
+    template<typename Object>
+        requires std::is_same_v<Object, Stream>
+    auto stream() noexcept -> Stream&
+    {
+        return m_stream;
+    }
+
+protected:
+    Stream& m_stream;
+};
+
+template<typename T>
+struct IsTypedSerializationContext : std::false_type {};
+
+template<template<typename...> typename Serializer, typename Stream>
+struct IsTypedSerializationContext<TypedSerializationContext<Serializer, Stream>> : std::true_type {};
+
+template<template<typename...> typename Serializer, typename Object>
+inline SerializationContext::SerializationContext(SerializerTag<Serializer>, Object& io, bool typed) noexcept
+    : m_serializer_type(typeid(SerializerTag<Serializer>))
+    , m_serializer_key(&type_key<SerializerTag<Serializer>>)
+    , m_io_key(&type_key<Object>)
     , m_io(std::addressof(io))
+    , m_typed(typed)
+{}
+
+inline SerializationContext::SerializationContext(const SerializerBinding& binding, void* io) noexcept
+    : m_serializer_type(*binding.m_serializer_type)
+    , m_serializer_key(binding.m_serializer_key)
+    , m_io_key(binding.m_io_key)
+    , m_io(io)
+    , m_typed(false)
 {}
 
 template<template<typename...> typename Serializer, typename Object>
@@ -84,18 +270,86 @@ template<template<typename...> typename Serializer, typename Object>
           or std::is_same_v<Object, typename SerializerTraits<Serializer>::Output>
 inline auto SerializationContext::create(Object& io) noexcept -> SerializationContext
 {
-    return SerializationContext { typeid(SerializerTag<Serializer>), io };
+    return SerializationContext { SerializerTag<Serializer> {}, io, false };
+}
+
+template<template<typename...> typename Serializer>
+inline auto SerializationContext::uses() const noexcept -> bool
+{
+    return m_serializer_key == &type_key<SerializerTag<Serializer>>;
+}
+
+inline auto SerializationContext::uses(const SerializerBinding& binding) const noexcept -> bool
+{
+    return m_serializer_key == binding.m_serializer_key;
+}
+
+template<typename Stream>
+inline auto SerializationContext::holds() const noexcept -> bool
+{
+    return m_io_key == &type_key<Stream>;
+}
+
+inline auto SerializationContext::typed() const noexcept -> bool
+{
+    return m_typed;
+}
+
+inline auto SerializationContext::binding() const noexcept -> SerializerBinding
+{
+    return SerializerBinding { m_serializer_type.get(), m_serializer_key, m_io_key };
+}
+
+inline auto SerializationContext::dictionary() const noexcept -> StringDictionary*
+{
+    return m_dictionary;
+}
+
+inline auto SerializationContext::setDictionary(StringDictionary* dictionary) noexcept -> void
+{
+    m_dictionary = dictionary;
+}
+
+template<template<typename...> typename Serializer, typename Stream>
+inline auto SerializationContext::typedAs() noexcept -> TypedSerializationContext<Serializer, Stream>*
+{
+    if (m_typed and uses<Serializer>() and m_io_key == &type_key<Stream>)
+        return static_cast<TypedSerializationContext<Serializer, Stream>*>(this);
+
+    return nullptr;
 }
 
 template<typename Stream>
 auto SerializationContext::stream() -> Stream&
 {
-    if (typeid(Stream) != m_io_type)
+    if (m_io_key != &type_key<Stream>)
         throw InvalidCastException("Invalid cast");
 
     return *reinterpret_cast<Stream*>(m_io);
 }
 
+inline SerializerBinding::SerializerBinding(const std::type_info& serializer_type,
+                                            const void* serializer_key, const void* io_key) noexcept
+    : m_serializer_type(&serializer_type)
+    , m_serializer_key(serializer_key)
+    , m_io_key(io_key)
+{}
+
+template<typename Stream>
+inline auto SerializerBinding::bind(Stream& io) const -> SerializationContext
+{
+    if (m_io_key != &type_key<Stream>)
+        throw InvalidCastException("Invalid cast");
+
+    return SerializationContext { *this, std::addressof(io) };
+}
+
+template<template<typename...> typename Serializer>
+inline auto SerializerBinding::uses() const noexcept -> bool
+{
+    return m_serializer_key == &type_key<SerializerTag<Serializer>>;
+}
+
 } // namespace isml
 
 #endif // ISML_SERIALIZATION_CONTEXT_HPP
@@ -17,6 +17,7 @@ namespace isml {
  * @brief   Serialize the given value using the specified serializer.
  *
  * @tparam  Serializer  Serializer type.
+ * @tparam  Context     Serialization context type.
  * @tparam  T           Value type.
  * @param   context     Serialization context.
  * @param   value       Value.
@@ -25,8 +26,8 @@ namespace isml {
  * @since   0.1.4
  */
 
-template<template<typename...> typename Serializer, typename T>
-auto serialize(SerializationContext& context, const T& value, const std::string& name) -> void
+template<template<typename...> typename Serializer, SerializationContextType Context, typename T>
+auto serialize(Context& context, const T& value, const std::string& name) -> void
 {
     Serializer<T>::serialize(context, value, name);
 }
@@ -35,6 +36,7 @@ auto serialize(SerializationContext& context, const T& value, const std::string&
  * @brief   Deserialize the given value using the specified serializer.
  *
  * @tparam  Serializer  Serializer type.
+ * @tparam  Context     Serialization context type.
  * @tparam  T           Value type.
  * @param   context     Serialization context.
  * @param   value       Value.
@@ -43,8 +45,8 @@ auto serialize(SerializationContext& context, const T& value, const std::string&
  * @since   0.1.4
  */
 
-template<template<typename...> typename Serializer, typename T>
-auto deserialize(SerializationContext& context, T& value, const std::string& name) -> void
+template<template<typename...> typename Serializer, SerializationContextType Context, typename T>
+auto deserialize(Context& context, T& value, const std::string& name) -> void
 {
     Serializer<T>::deserialize(context, value, name);
 }
@@ -54,6 +56,7 @@ auto deserialize(SerializationContext& context, T& value, const std::string& nam
  *          Specialization for the composed serializer.
  *
  * @tparam  Serializer  Serializer type.
+ * @tparam  Context     Serialization context type.
  * @tparam  T           Value type.
  * @param   context     Serialization context.
  * @param   value       Value.
@@ -62,9 +65,9 @@ auto deserialize(SerializationContext& context, T& value, const std::string& nam
  * @since   0.1.4
  */
 
-template<typename Serializer, typename T>
+template<typename Serializer, SerializationContextType Context, typename T>
     requires IsCompositeSerializer<Serializer>::value
-auto serialize(SerializationContext& context, const T& value, const std::string& name) -> void
+auto serialize(Context& context, const T& value, const std::string& name) -> void
 {
     Serializer::serialize(context, value, name);
 }
@@ -74,6 +77,7 @@ auto serialize(SerializationContext& context, const T& value, const std::string&
  *          Specialization for the composed serializer.
  *
  * @tparam  Serializer  Serializer type.
+ * @tparam  Context     Serialization context type.
  * @tparam  T           Value type.
  * @param   context     Serialization context.
  * @param   value       Value.
@@ -82,9 +86,9 @@ auto serialize(SerializationContext& context, const T& value, const std::string&
  * @since   0.1.4
  */
 
-template<typename Serializer, typename T>
+template<typename Serializer, SerializationContextType Context, typename T>
     requires IsCompositeSerializer<Serializer>::value
-auto deserialize(SerializationContext& context, T& value, const std::string& name) -> void
+auto deserialize(Context& context, T& value, const std::string& name) -> void
 {
     Serializer::deserialize(context, value, name);
 }
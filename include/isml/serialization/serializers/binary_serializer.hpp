@@ -9,27 +9,34 @@
 
 #include <cassert>
 #include <bit>
+#include <algorithm>
 
 #include <numeric>
 #include <cstddef>
 #include <utility>
-#include <sstream>
 #include <concepts>
+#include <ranges>
+#include <memory>
 
+#include <isml/exceptions.hpp>
+
+#include <isml/base/borrowed.hpp>
 #include <isml/base/byte.hpp>
 #include <isml/base/concepts.hpp>
 
+#include <isml/serialization/binary_io.hpp>
 #include <isml/serialization/serializable.hpp>
 #include <isml/serialization/serializer_traits.hpp>
+#include <isml/serialization/string_dictionary.hpp>
 
 namespace isml {
 namespace binary {
 
-template<typename T>
-auto serialize(SerializationContext& context, const T& value) -> void;
+template<SerializationContextType Context, typename T>
+auto serialize(Context& context, const T& value) -> void;
 
-template<typename T>
-auto deserialize(SerializationContext& context, T& value) -> void;
+template<SerializationContextType Context, typename T>
+auto deserialize(Context& context, T& value) -> void;
 
 template<typename T>
 auto size(const T& value) -> std::size_t;
@@ -47,6 +54,28 @@ concept CanCalculateSelfBinarySize =
         { t.serializedSize() } -> std::same_as<std::size_t>;
     };
 
+/**
+ * @brief   Contiguous containers of fixed-width elements having the same
+ *          representation in memory and on the wire (up to the byte order).
+ *          They are encoded and decoded with a single copy.
+ */
+
+template<typename C>
+concept BulkBinaryContainer =
+    std::ranges::contiguous_range<C> &&
+    (std::is_arithmetic_v<std::ranges::range_value_t<C>> or std::is_enum_v<std::ranges::range_value_t<C>>);
+
+/**
+ * @brief   Values of a fixed size having the same representation in memory
+ *          and on the wire up to the byte order: numbers, enumerations and
+ *          arrays of them (the arrays are preceded by the element count).
+ */
+
+template<typename T>
+concept FixedBinaryValue =
+    std::is_arithmetic_v<T> or std::is_enum_v<T> or
+    (IsArray<T>::value and BulkBinaryContainer<T>);
+
 class BinarySerializerBase
 {
 public:
@@ -59,11 +88,14 @@ protected:
     template<typename C>
     static auto size(const C& container) noexcept -> std::size_t
     {
-        return std::accumulate(std::cbegin(container), std::cend(container), sizeof(ContainerSize),
-            [](std::size_t sum, const auto& value)
-                {
-                    return sum + binary::size(value);
-                });
+        if constexpr (BulkBinaryContainer<C>)
+            return sizeof(ContainerSize) + std::size(container) * sizeof(std::ranges::range_value_t<C>);
+        else
+            return std::accumulate(std::cbegin(container), std::cend(container), sizeof(ContainerSize),
+                [](std::size_t sum, const auto& value)
+                    {
+                        return sum + binary::size(value);
+                    });
     }
 
     template<typename T>
@@ -75,6 +107,90 @@ protected:
         }
     }
 
+    template<typename T>
+    static auto swapBytesIfNeeded(T* values, std::size_t count) noexcept -> void
+    {
+        if constexpr (std::endian::native == std::endian::big)
+        {
+            if constexpr (std::is_enum_v<T>)
+                ByteUtils::swap(reinterpret_cast<std::underlying_type_t<T>*>(values), count);
+            else
+                ByteUtils::swap(values, count);
+        }
+    }
+
+    /// Writes the elements of a contiguous container at once.
+    template<SerializationContextType Context, typename C>
+    static auto writeBulk(Context& context, const C& container) -> void
+    {
+        using Item = std::ranges::range_value_t<C>;
+
+        auto& writer = context.template stream<BinaryWriter>();
+        const auto count = std::size(container);
+        const auto length = count * sizeof(Item);
+
+        if constexpr (std::endian::native == std::endian::big)
+        {
+            auto items = std::make_unique_for_overwrite<Item[]>(count);
+            std::copy(std::cbegin(container), std::cend(container), items.get());
+            swapBytesIfNeeded(items.get(), count);
+            writer.write(items.get(), length);
+        }
+        else
+        {
+            writer.write(std::data(container), length);
+        }
+    }
+
+    /// Reads the elements of a contiguous container at once.
+    template<SerializationContextType Context, typename C>
+    static auto readBulk(Context& context, C& container) -> void
+    {
+        using Item = std::ranges::range_value_t<C>;
+
+        auto& reader = context.template stream<BinaryReader>();
+        const auto count = std::size(container);
+        reader.read(std::data(container), count * sizeof(Item));
+        swapBytesIfNeeded(std::data(container), count);
+    }
+
+    /// String prefixes written with a dictionary: a literal, a definition
+    /// (ORed with the identifier) or a reference (the identifier plus one).
+    static constexpr std::uint16_t k_string_literal = 0x0000U;
+    static constexpr std::uint16_t k_string_definition = 0x8000U;
+
+    /**
+     * @brief   Interns the string and writes its prefix.
+     *
+     * @return  False if the string is written as a reference, i.e. its
+     *          characters must not follow.
+     */
+
+    template<SerializationContextType Context>
+    static auto writeStringPrefix(Context& context, StringDictionary& dictionary, std::string_view value) -> bool
+    {
+        auto prefix = k_string_literal;
+        if (dictionary.accepts(value))
+        {
+            const auto [id, inserted] = dictionary.intern(value);
+            if (!inserted)
+            {
+                binary::serialize(context, static_cast<std::uint16_t>(id + 1U));
+                return false;
+            }
+
+            prefix = static_cast<std::uint16_t>(k_string_definition | id);
+        }
+
+        binary::serialize(context, prefix);
+        return true;
+    }
+
+    static constexpr auto isStringReference(std::uint16_t prefix) noexcept -> bool
+    {
+        return prefix != k_string_literal and (prefix & k_string_definition) == 0U;
+    }
+
 public:
     static constexpr std::uint64_t max_container_size = ~static_cast<ContainerSize>(0);
 };
@@ -88,17 +204,19 @@ class BinarySerializer<T, std::enable_if_t<std::is_integral_v<T> or
     : public BinarySerializerBase
 {
 public:
-    static auto serialize(SerializationContext& context, T value, const std::string&) -> void
+    template<SerializationContextType Context>
+    static auto serialize(Context& context, T value, const std::string&) -> void
     {
-        auto& stream = context.stream<std::stringstream>();
+        auto& writer = context.template stream<BinaryWriter>();
         swapBytesIfNeeded(value);
-        stream.write(reinterpret_cast<const char*>(&value), sizeof value);
+        writer.write(&value, sizeof value);
     }
 
-    static auto deserialize(SerializationContext& context, T& value, const std::string&) -> void
+    template<SerializationContextType Context>
+    static auto deserialize(Context& context, T& value, const std::string&) -> void
     {
-        auto& stream = context.stream<std::stringstream>();
-        stream.read(reinterpret_cast<char*>(&value), sizeof value);
+        auto& reader = context.template stream<BinaryReader>();
+        reader.read(&value, sizeof value);
         swapBytesIfNeeded(value);
     }
 
@@ -112,13 +230,15 @@ template<typename T>
 class BinarySerializer<T, std::enable_if_t<IsPair<T>::value>>
 {
 public:
-    static auto serialize(SerializationContext& context, const T& pair, const std::string&) -> void
+    template<SerializationContextType Context>
+    static auto serialize(Context& context, const T& pair, const std::string&) -> void
     {
         binary::serialize(context, pair.first);
         binary::serialize(context, pair.second);
     }
 
-    static auto deserialize(SerializationContext& context, T& pair, const std::string&) -> void
+    template<SerializationContextType Context>
+    static auto deserialize(Context& context, T& pair, const std::string&) -> void
     {
         binary::deserialize(context, pair.first);
         binary::deserialize(context, pair.second);
@@ -138,7 +258,8 @@ class BinarySerializer<T, std::enable_if_t<IsOptional<T>::value>>
     : public BinarySerializerBase
 {
 public:
-    static auto serialize(SerializationContext& context, const T& optional, const std::string&) -> void
+    template<SerializationContextType Context>
+    static auto serialize(Context& context, const T& optional, const std::string&) -> void
     {
         const auto value_present = optional.has_value();
         swapBytesIfNeeded(value_present);
@@ -147,7 +268,8 @@ public:
             binary::serialize(context, *optional);
     }
 
-    static auto deserialize(SerializationContext& context, T& optional, const std::string&) -> void
+    template<SerializationContextType Context>
+    static auto deserialize(Context& context, T& optional, const std::string&) -> void
     {
         bool value_present;
         binary::deserialize(context, value_present);
@@ -174,26 +296,102 @@ class BinarySerializer<T, std::enable_if_t<SequenceContainer<T>>>
     : public BinarySerializerBase
 {
 public:
-    static auto serialize(SerializationContext& context, const T& container, const std::string&) -> void
+    template<SerializationContextType Context>
+    static auto serialize(Context& context, const T& container, const std::string&) -> void
+    {
+        if constexpr (std::is_same_v<T, std::string>)
+        {
+            if (auto* dictionary = context.dictionary())
+            {
+                serializeInterned(context, *dictionary, container);
+                return;
+            }
+        }
+
+        serializeItems(context, container);
+    }
+
+    template<SerializationContextType Context>
+    static auto deserialize(Context& context, T& container, const std::string&) -> void
+    {
+        if constexpr (std::is_same_v<T, std::string>)
+        {
+            if (auto* dictionary = context.dictionary())
+            {
+                deserializeInterned(context, *dictionary, container);
+                return;
+            }
+        }
+
+        deserializeItems(context, container);
+    }
+
+    static auto size(const T& container) noexcept -> std::size_t
+    {
+        return BinarySerializerBase::size(container);
+    }
+
+protected:
+    template<SerializationContextType Context>
+    static auto serializeItems(Context& context, const T& container) -> void
     {
         assert(container.size() <= max_container_size);
         binary::serialize(context, static_cast<ContainerSize>(container.size()));
-        for (const auto& item : container)
-            binary::serialize(context, item);
+        if constexpr (BulkBinaryContainer<T>)
+        {
+            writeBulk(context, container);
+        }
+        else
+        {
+            for (const auto& item : container)
+                binary::serialize(context, item);
+        }
     }
 
-    static auto deserialize(SerializationContext& context, T& container, const std::string&) -> void
+    template<SerializationContextType Context>
+    static auto deserializeItems(Context& context, T& container) -> void
     {
         ContainerSize item_count;
         binary::deserialize(context, item_count);
-        container.resize(item_count);
-        for (auto& item : container)
-            binary::deserialize(context, item);
+        if constexpr (BulkBinaryContainer<T>)
+        {
+            // Don't resize the container before the data is known to be complete
+            if (context.template stream<BinaryReader>().remaining() < item_count * sizeof(typename T::value_type))
+                throw IOException("Unexpected end of data");
+
+            container.resize(item_count);
+            readBulk(context, container);
+        }
+        else
+        {
+            container.resize(item_count);
+            for (auto& item : container)
+                binary::deserialize(context, item);
+        }
     }
 
-    static auto size(const T& container) noexcept -> std::size_t
+    template<SerializationContextType Context>
+    static auto serializeInterned(Context& context, StringDictionary& dictionary, const T& value) -> void
     {
-        return BinarySerializerBase::size(container);
+        if (writeStringPrefix(context, dictionary, value))
+            serializeItems(context, value);
+    }
+
+    template<SerializationContextType Context>
+    static auto deserializeInterned(Context& context, StringDictionary& dictionary, T& value) -> void
+    {
+        std::uint16_t prefix {};
+        binary::deserialize(context, prefix);
+
+        if (isStringReference(prefix))
+        {
+            value = dictionary.at(static_cast<StringDictionary::Id>(prefix - 1U));
+            return;
+        }
+
+        deserializeItems(context, value);
+        if (prefix & k_string_definition)
+            dictionary.define(static_cast<StringDictionary::Id>(prefix & ~k_string_definition), value);
     }
 };
 
@@ -202,14 +400,16 @@ class BinarySerializer<T, std::enable_if_t<AssociativeContainer<T>>>
     : public BinarySerializerBase
 {
 public:
-    static auto serialize(SerializationContext& context, const T& container, const std::string&) -> void
+    template<SerializationContextType Context>
+    static auto serialize(Context& context, const T& container, const std::string&) -> void
     {
         binary::serialize(context, static_cast<ContainerSize>(container.size()));
         for (const auto& item : container)
             binary::serialize(context, item);
     }
 
-    static auto deserialize(SerializationContext& context, T& container, const std::string&) -> void
+    template<SerializationContextType Context>
+    static auto deserialize(Context& context, T& container, const std::string&) -> void
     {
         ContainerSize item_count;
         binary::deserialize(context, item_count);
@@ -250,19 +450,21 @@ class BinarySerializer<T, std::enable_if_t<std::is_enum_v<T>>>
     : public BinarySerializerBase
 {
 public:
-    static auto serialize(SerializationContext& context, const T& enumerator, const std::string&) -> void
+    template<SerializationContextType Context>
+    static auto serialize(Context& context, const T& enumerator, const std::string&) -> void
     {
-        auto& stream = context.stream<std::stringstream>();
+        auto& writer = context.template stream<BinaryWriter>();
         auto value = static_cast<std::underlying_type_t<T>>(enumerator);
         swapBytesIfNeeded(value);
-        stream.write(reinterpret_cast<const char*>(&value), sizeof value);
+        writer.write(&value, sizeof value);
     }
 
-    static auto deserialize(SerializationContext& context, T& enumerator, const std::string&) -> void
+    template<SerializationContextType Context>
+    static auto deserialize(Context& context, T& enumerator, const std::string&) -> void
     {
-        auto& stream = context.stream<std::stringstream>();
+        auto& reader = context.template stream<BinaryReader>();
         std::underlying_type_t<T> value;
-        stream.read(reinterpret_cast<char*>(&value), sizeof value);
+        reader.read(&value, sizeof value);
         swapBytesIfNeeded(value);
         enumerator = static_cast<T>(value);
     }
@@ -278,20 +480,38 @@ class BinarySerializer<T, std::enable_if_t<IsArray<T>::value>>
     : public BinarySerializerBase
 {
 public:
-    static auto serialize(SerializationContext& context, const T& array, const std::string&) -> void
+    template<SerializationContextType Context>
+    static auto serialize(Context& context, const T& array, const std::string&) -> void
     {
         binary::serialize(context, static_cast<ContainerSize>(array.size()));
-        for (const auto& item : array)
-            binary::serialize(context, item);
+        if constexpr (BulkBinaryContainer<T>)
+        {
+            writeBulk(context, array);
+        }
+        else
+        {
+            for (const auto& item : array)
+                binary::serialize(context, item);
+        }
     }
 
-    static auto deserialize(SerializationContext& context, T& array, const std::string&) -> void
+    template<SerializationContextType Context>
+    static auto deserialize(Context& context, T& array, const std::string&) -> void
     {
         ContainerSize item_count;
         binary::deserialize(context, item_count);
-        assert(item_count == array.size());
-        for (auto& item : array)
-            binary::deserialize(context, item);
+        if (item_count != array.size())
+            throw IOException("Element count doesn't match the array size");
+
+        if constexpr (BulkBinaryContainer<T>)
+        {
+            readBulk(context, array);
+        }
+        else
+        {
+            for (auto& item : array)
+                binary::deserialize(context, item);
+        }
     }
 
     static auto size(const T& array) noexcept -> std::size_t
@@ -300,17 +520,107 @@ public:
     }
 };
 
+/**
+ * @brief   Borrowed strings and byte spans are encoded as the owning ones.
+ *          The decoded values refer to the backing buffer of the reader (see
+ *          BinaryReader::takeShared), strings resolved by a dictionary refer
+ *          to copies.
+ */
+
+template<typename T>
+class BinarySerializer<T, std::enable_if_t<IsBorrowed<T>::value>>
+    : public BinarySerializerBase
+{
+public:
+    template<SerializationContextType Context>
+    static auto serialize(Context& context, const T& value, const std::string&) -> void
+    {
+        const std::string_view bytes { reinterpret_cast<const char*>(value.data()), value.size() };
+        if constexpr (std::is_same_v<T, BorrowedString>)
+        {
+            if (auto* dictionary = context.dictionary())
+            {
+                if (writeStringPrefix(context, *dictionary, bytes))
+                    serializeBytes(context, bytes);
+                return;
+            }
+        }
+
+        serializeBytes(context, bytes);
+    }
+
+    template<SerializationContextType Context>
+    static auto deserialize(Context& context, T& value, const std::string&) -> void
+    {
+        if constexpr (std::is_same_v<T, BorrowedString>)
+        {
+            if (auto* dictionary = context.dictionary())
+            {
+                deserializeInterned(context, *dictionary, value);
+                return;
+            }
+        }
+
+        deserializeBytes(context, value);
+    }
+
+    static auto size(const T& value) noexcept -> std::size_t
+    {
+        return sizeof(ContainerSize) + value.size();
+    }
+
+protected:
+    template<SerializationContextType Context>
+    static auto serializeBytes(Context& context, std::string_view bytes) -> void
+    {
+        assert(bytes.size() <= max_container_size);
+        binary::serialize(context, static_cast<ContainerSize>(bytes.size()));
+        context.template stream<BinaryWriter>().write(bytes.data(), bytes.size());
+    }
+
+    template<SerializationContextType Context>
+    static auto deserializeBytes(Context& context, T& value) -> void
+    {
+        ContainerSize length;
+        binary::deserialize(context, length);
+        auto [buffer, bytes] = context.template stream<BinaryReader>().takeShared(length);
+        value = T { std::move(buffer), bytes };
+    }
+
+    template<SerializationContextType Context>
+    static auto deserializeInterned(Context& context, StringDictionary& dictionary, T& value) -> void
+    {
+        std::uint16_t prefix {};
+        binary::deserialize(context, prefix);
+
+        // The strings of the dictionary may be replaced, so they are copied
+        if (isStringReference(prefix))
+        {
+            auto buffer = SharedBuffer::copy(nullptr, dictionary.at(static_cast<StringDictionary::Id>(prefix - 1U)));
+            const auto bytes = buffer.view();
+            value = T { std::move(buffer), bytes };
+            return;
+        }
+
+        deserializeBytes(context, value);
+        if (prefix & k_string_definition)
+            dictionary.define(static_cast<StringDictionary::Id>(prefix & ~k_string_definition), value.view());
+    }
+};
+
 template<typename T>
 class BinarySerializer<T, std::enable_if_t<std::is_base_of_v<Serializable, T>>>
     : public BinarySerializerBase
 {
 public:
-    static auto serialize(SerializationContext& context, const T& object, const std::string&) -> void
+    template<SerializationContextType Context>
+    static auto serialize(Context& context, const T& object, const std::string&) -> void
     {
         object.serialize(context);
     }
 
-    static auto deserialize(SerializationContext& context, T& object, const std::string&) -> void
+    template<SerializationContextType Context>
+    static auto deserialize(Context& context, T& object, const std::string&) -> void
     {
         object.deserialize(context);
     }
@@ -324,20 +634,20 @@ public:
 template<>
 struct SerializerTraits<BinarySerializer>
 {
-    using Input = std::stringstream;
-    using Output = std::stringstream;
+    using Input = BinaryReader;
+    using Output = BinaryWriter;
 };
 
 namespace binary {
 
-template<typename T>
-inline auto serialize(SerializationContext& context, const T& value) -> void
+template<SerializationContextType Context, typename T>
+inline auto serialize(Context& context, const T& value) -> void
 {
     BinarySerializer<T>::serialize(context, value, "");
 }
 
-template<typename T>
-inline auto deserialize(SerializationContext& context, T& value) -> void
+template<SerializationContextType Context, typename T>
+inline auto deserialize(Context& context, T& value) -> void
 {
     BinarySerializer<T>::deserialize(context, value, "");
 }
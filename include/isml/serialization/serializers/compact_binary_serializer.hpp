@@ -0,0 +1,587 @@
+/**
+ * @file    compact_binary_serializer.hpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#ifndef ISML_COMPACT_BINARY_SERIALIZER_HPP
+#define ISML_COMPACT_BINARY_SERIALIZER_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <ranges>
+#include <utility>
+
+#include <isml/exceptions.hpp>
+
+#include <isml/base/borrowed.hpp>
+#include <isml/base/byte.hpp>
+#include <isml/base/concepts.hpp>
+
+#include <isml/serialization/binary_io.hpp>
+#include <isml/serialization/serializable.hpp>
+#include <isml/serialization/serializer_traits.hpp>
+
+namespace isml {
+namespace compact {
+
+template<SerializationContextType Context, typename T>
+auto serialize(Context& context, const T& value) -> void;
+
+template<SerializationContextType Context, typename T>
+auto deserialize(Context& context, T& value) -> void;
+
+template<typename T>
+auto size(const T& value) -> std::size_t;
+
+} // namespace compact
+
+/**
+ * @brief   Contiguous containers of elements written as is (bytes and
+ *          floating point numbers), encoded and decoded with a single copy.
+ */
+
+template<typename C>
+concept CompactBulkContainer =
+    std::ranges::contiguous_range<C> &&
+    std::is_arithmetic_v<std::ranges::range_value_t<C>> &&
+    (sizeof(std::ranges::range_value_t<C>) == 1U or std::is_floating_point_v<std::ranges::range_value_t<C>>);
+
+/**
+ * @class   CompactBinarySerializerBase
+ * @brief   Variable-length integer encoding shared by the compact serializers.
+ *
+ *          Integers wider than a byte and container sizes are written as
+ *          LEB128 varints (7 bits per byte, the high bit marks continuation),
+ *          signed integers are zigzag-mapped first so small negative values
+ *          stay short. Bytes and floating point numbers are written as is in
+ *          little-endian order.
+ * @since   0.1.7
+ */
+
+class CompactBinarySerializerBase
+{
+public:
+    static constexpr std::size_t k_max_varint_size = 10U;
+
+protected:
+    ~CompactBinarySerializerBase() = default;
+
+public:
+    static auto writeVarint(BinaryWriter& writer, std::uint64_t value) -> void
+    {
+        char bytes[k_max_varint_size];
+        std::size_t length = 0U;
+        while (value >= 0x80U)
+        {
+            bytes[length++] = static_cast<char>(value | 0x80U);
+            value >>= 7U;
+        }
+
+        bytes[length++] = static_cast<char>(value);
+        writer.write(bytes, length);
+    }
+
+    /**
+     * @brief   Reads a varint. Longer varints of up to 8 bytes (56 bits) are
+     *          decoded from a single 64-bit load without branching on every
+     *          byte.
+     */
+
+    static auto readVarint(BinaryReader& reader) -> std::uint64_t
+    {
+        // Most values fit a single byte
+        if (reader.remaining() and !(reader.peek(1U)[0] & 0x80))
+            return static_cast<std::uint64_t>(reader.take(1U)[0]);
+
+        if (reader.remaining() >= sizeof(std::uint64_t))
+        {
+            std::uint64_t word;
+            std::memcpy(&word, reader.peek(sizeof word).data(), sizeof word);
+            if constexpr (std::endian::native == std::endian::big)
+                ByteUtils::swap(word);
+
+            // The first byte with the high bit cleared terminates the varint
+            const auto stops = ~word & 0x8080808080808080ULL;
+            if (stops)
+            {
+                const auto bits = static_cast<unsigned>(std::countr_zero(stops)) + 1U;
+                auto value = word & (~0ULL >> (64U - bits));
+
+                // Squeeze out the continuation bits: 7-bit groups are merged
+                // into 14-, 28- and finally 56-bit ones
+                value = (value & 0x007F007F007F007FULL) | ((value & 0x7F007F007F007F00ULL) >> 1U);
+                value = (value & 0x00003FFF00003FFFULL) | ((value & 0x3FFF00003FFF0000ULL) >> 2U);
+                value = (value & 0x000000000FFFFFFFULL) | ((value & 0x0FFFFFFF00000000ULL) >> 4U);
+
+                reader.skip(bits / 8U);
+                return value;
+            }
+        }
+
+        return readVarintSlow(reader);
+    }
+
+    static constexpr auto varintSize(std::uint64_t value) noexcept -> std::size_t
+    {
+        return 1U + (static_cast<std::size_t>(std::bit_width(value | 1U)) - 1U) / 7U;
+    }
+
+    template<typename T>
+    static constexpr auto zigzag(T value) noexcept -> std::make_unsigned_t<T>
+    {
+        using U = std::make_unsigned_t<T>;
+        return static_cast<U>(static_cast<U>(value) << 1U) ^ static_cast<U>(value >> (std::numeric_limits<U>::digits - 1));
+    }
+
+    template<typename T>
+    static constexpr auto unzigzag(std::make_unsigned_t<T> value) noexcept -> T
+    {
+        using U = std::make_unsigned_t<T>;
+        return static_cast<T>(static_cast<U>(value >> 1U) ^ static_cast<U>(-static_cast<U>(value & 1U)));
+    }
+
+    /// Reads a varint checking that it fits the type.
+    template<typename T>
+    static auto readVarint(BinaryReader& reader) -> T
+    {
+        const auto value = readVarint(reader);
+        if (value > std::numeric_limits<T>::max())
+            throw IOException("Varint overflow");
+
+        return static_cast<T>(value);
+    }
+
+protected:
+    static auto readVarintSlow(BinaryReader& reader) -> std::uint64_t
+    {
+        std::uint64_t value = 0U;
+        for (std::size_t i = 0U; i < k_max_varint_size; ++i)
+        {
+            std::uint8_t byte;
+            reader.read(&byte, sizeof byte);
+
+            // The last byte holds the 64th bit only
+            if (i == k_max_varint_size - 1U and byte > 1U)
+                throw IOException("Varint overflow");
+
+            value |= static_cast<std::uint64_t>(byte & 0x7FU) << (7U * i);
+            if (!(byte & 0x80U))
+                return value;
+        }
+
+        throw IOException("Varint is too long");
+    }
+
+    template<typename T>
+    static auto writeRaw(BinaryWriter& writer, T value) -> void
+    {
+        if constexpr (std::endian::native == std::endian::big)
+            ByteUtils::swap(value);
+
+        writer.write(&value, sizeof value);
+    }
+
+    template<typename T>
+    static auto readRaw(BinaryReader& reader, T& value) -> void
+    {
+        reader.read(&value, sizeof value);
+        if constexpr (std::endian::native == std::endian::big)
+            ByteUtils::swap(value);
+    }
+
+    template<typename C>
+    static auto itemsSize(const C& container) -> std::size_t
+    {
+        if constexpr (CompactBulkContainer<C>)
+        {
+            return std::size(container) * sizeof(std::ranges::range_value_t<C>);
+        }
+        else
+        {
+            std::size_t size = 0U;
+            for (const auto& item : container)
+                size += compact::size(item);
+            return size;
+        }
+    }
+
+    template<SerializationContextType Context, typename C>
+    static auto writeItems(Context& context, const C& container) -> void
+    {
+        if constexpr (CompactBulkContainer<C> and (sizeof(std::ranges::range_value_t<C>) == 1U
+                                                 or std::endian::native == std::endian::little))
+        {
+            context.template stream<BinaryWriter>().write(std::data(container),
+                std::size(container) * sizeof(std::ranges::range_value_t<C>));
+        }
+        else if constexpr (std::is_integral_v<std::ranges::range_value_t<C>>)
+        {
+            // Varints are written directly, without going through the context
+            auto& writer = context.template stream<BinaryWriter>();
+            for (const auto item : container)
+            {
+                if constexpr (std::is_signed_v<decltype(item)>)
+                    writeVarint(writer, zigzag(item));
+                else
+                    writeVarint(writer, item);
+            }
+        }
+        else
+        {
+            for (const auto& item : container)
+                compact::serialize(context, item);
+        }
+    }
+
+    template<SerializationContextType Context, typename C>
+    static auto readItems(Context& context, C& container) -> void
+    {
+        if constexpr (CompactBulkContainer<C> and (sizeof(std::ranges::range_value_t<C>) == 1U
+                                                 or std::endian::native == std::endian::little))
+        {
+            context.template stream<BinaryReader>().read(std::data(container),
+                std::size(container) * sizeof(std::ranges::range_value_t<C>));
+        }
+        else if constexpr (std::is_integral_v<std::ranges::range_value_t<C>>)
+        {
+            using Item = std::ranges::range_value_t<C>;
+
+            auto& reader = context.template stream<BinaryReader>();
+            for (auto& item : container)
+            {
+                if constexpr (std::is_signed_v<Item>)
+                    item = unzigzag<Item>(readVarint<std::make_unsigned_t<Item>>(reader));
+                else
+                    item = readVarint<Item>(reader);
+            }
+        }
+        else
+        {
+            for (auto& item : container)
+                compact::deserialize(context, item);
+        }
+    }
+};
+
+template<typename T, typename P = void>
+class CompactBinarySerializer;
+
+template<typename T>
+class CompactBinarySerializer<T, std::enable_if_t<std::is_integral_v<T> or
+                                                  std::is_floating_point_v<T>>>
+    : public CompactBinarySerializerBase
+{
+public:
+    template<SerializationContextType Context>
+    static auto serialize(Context& context, T value, const std::string&) -> void
+    {
+        auto& writer = context.template stream<BinaryWriter>();
+        if constexpr (sizeof(T) == 1U or std::is_floating_point_v<T>)
+            writeRaw(writer, value);
+        else if constexpr (std::is_signed_v<T>)
+            writeVarint(writer, zigzag(value));
+        else
+            writeVarint(writer, value);
+    }
+
+    template<SerializationContextType Context>
+    static auto deserialize(Context& context, T& value, const std::string&) -> void
+    {
+        auto& reader = context.template stream<BinaryReader>();
+        if constexpr (sizeof(T) == 1U or std::is_floating_point_v<T>)
+            readRaw(reader, value);
+        else if constexpr (std::is_signed_v<T>)
+            value = unzigzag<T>(readVarint<std::make_unsigned_t<T>>(reader));
+        else
+            value = readVarint<T>(reader);
+    }
+
+    static auto size(const T& value) noexcept -> std::size_t
+    {
+        if constexpr (sizeof(T) == 1U or std::is_floating_point_v<T>)
+            return sizeof(T);
+        else if constexpr (std::is_signed_v<T>)
+            return varintSize(zigzag(value));
+        else
+            return varintSize(value);
+    }
+};
+
+template<typename T>
+class CompactBinarySerializer<T, std::enable_if_t<std::is_enum_v<T>>>
+    : public CompactBinarySerializerBase
+{
+    using Underlying = std::underlying_type_t<T>;
+
+public:
+    template<SerializationContextType Context>
+    static auto serialize(Context& context, const T& enumerator, const std::string&) -> void
+    {
+        compact::serialize(context, static_cast<Underlying>(enumerator));
+    }
+
+    template<SerializationContextType Context>
+    static auto deserialize(Context& context, T& enumerator, const std::string&) -> void
+    {
+        Underlying value;
+        compact::deserialize(context, value);
+        enumerator = static_cast<T>(value);
+    }
+
+    static auto size(const T& enumerator) noexcept -> std::size_t
+    {
+        return compact::size(static_cast<Underlying>(enumerator));
+    }
+};
+
+template<typename T>
+class CompactBinarySerializer<T, std::enable_if_t<IsPair<T>::value>>
+    : public CompactBinarySerializerBase
+{
+public:
+    template<SerializationContextType Context>
+    static auto serialize(Context& context, const T& pair, const std::string&) -> void
+    {
+        compact::serialize(context, pair.first);
+        compact::serialize(context, pair.second);
+    }
+
+    template<SerializationContextType Context>
+    static auto deserialize(Context& context, T& pair, const std::string&) -> void
+    {
+        compact::deserialize(context, pair.first);
+        compact::deserialize(context, pair.second);
+    }
+
+    static auto size(const T& pair) -> std::size_t
+    {
+        return compact::size(pair.first) + compact::size(pair.second);
+    }
+};
+
+template<typename T>
+class CompactBinarySerializer<T, std::enable_if_t<IsOptional<T>::value>>
+    : public CompactBinarySerializerBase
+{
+public:
+    template<SerializationContextType Context>
+    static auto serialize(Context& context, const T& optional, const std::string&) -> void
+    {
+        compact::serialize(context, optional.has_value());
+        if (optional.has_value())
+            compact::serialize(context, *optional);
+    }
+
+    template<SerializationContextType Context>
+    static auto deserialize(Context& context, T& optional, const std::string&) -> void
+    {
+        bool value_present;
+        compact::deserialize(context, value_present);
+        optional.reset();
+        if (value_present)
+        {
+            typename T::value_type value;
+            compact::deserialize(context, value);
+            optional = std::make_optional(std::move(value));
+        }
+    }
+
+    static auto size(const T& optional) -> std::size_t
+    {
+        return sizeof(bool) + (optional.has_value() ? compact::size(*optional) : 0U);
+    }
+};
+
+template<typename T>
+class CompactBinarySerializer<T, std::enable_if_t<SequenceContainer<T>>>
+    : public CompactBinarySerializerBase
+{
+public:
+    template<SerializationContextType Context>
+    static auto serialize(Context& context, const T& container, const std::string&) -> void
+    {
+        writeVarint(context.template stream<BinaryWriter>(), container.size());
+        writeItems(context, container);
+    }
+
+    template<SerializationContextType Context>
+    static auto deserialize(Context& context, T& container, const std::string&) -> void
+    {
+        auto& reader = context.template stream<BinaryReader>();
+        const auto item_count = readVarint<std::size_t>(reader);
+
+        // Every item takes at least a byte
+        if (item_count > reader.remaining())
+            throw IOException("Unexpected end of data");
+
+        container.resize(item_count);
+        readItems(context, container);
+    }
+
+    static auto size(const T& container) -> std::size_t
+    {
+        return varintSize(container.size()) + itemsSize(container);
+    }
+};
+
+template<typename T>
+class CompactBinarySerializer<T, std::enable_if_t<AssociativeContainer<T>>>
+    : public CompactBinarySerializerBase
+{
+public:
+    template<SerializationContextType Context>
+    static auto serialize(Context& context, const T& container, const std::string&) -> void
+    {
+        writeVarint(context.template stream<BinaryWriter>(), container.size());
+        for (const auto& item : container)
+            compact::serialize(context, item);
+    }
+
+    template<SerializationContextType Context>
+    static auto deserialize(Context& context, T& container, const std::string&) -> void
+    {
+        auto& reader = context.template stream<BinaryReader>();
+        const auto item_count = readVarint<std::size_t>(reader);
+        if (item_count > reader.remaining())
+            throw IOException("Unexpected end of data");
+
+        container.clear();
+        for (std::size_t i = 0; i < item_count; ++i)
+        {
+            if constexpr (Map<T>)
+            {
+                typename T::key_type key;
+                compact::deserialize(context, key);
+                typename T::mapped_type value;
+                compact::deserialize(context, value);
+                container.insert(std::make_pair(std::move(key), std::move(value)));
+            }
+            else
+            {
+                typename T::key_type key;
+                compact::deserialize(context, key);
+                container.insert(std::move(key));
+            }
+        }
+    }
+
+    static auto size(const T& container) -> std::size_t
+    {
+        return varintSize(container.size()) + itemsSize(container);
+    }
+};
+
+/**
+ * @brief   The size of an array is known to both peers, so only the items
+ *          are written.
+ */
+
+template<typename T>
+class CompactBinarySerializer<T, std::enable_if_t<IsArray<T>::value>>
+    : public CompactBinarySerializerBase
+{
+public:
+    template<SerializationContextType Context>
+    static auto serialize(Context& context, const T& array, const std::string&) -> void
+    {
+        writeItems(context, array);
+    }
+
+    template<SerializationContextType Context>
+    static auto deserialize(Context& context, T& array, const std::string&) -> void
+    {
+        readItems(context, array);
+    }
+
+    static auto size(const T& array) -> std::size_t
+    {
+        return itemsSize(array);
+    }
+};
+
+/**
+ * @brief   Borrowed strings and byte spans are encoded as the owning ones,
+ *          the decoded values refer to the backing buffer of the reader.
+ */
+
+template<typename T>
+class CompactBinarySerializer<T, std::enable_if_t<IsBorrowed<T>::value>>
+    : public CompactBinarySerializerBase
+{
+public:
+    template<SerializationContextType Context>
+    static auto serialize(Context& context, const T& value, const std::string&) -> void
+    {
+        auto& writer = context.template stream<BinaryWriter>();
+        writeVarint(writer, value.size());
+        writer.write(value.data(), value.size());
+    }
+
+    template<SerializationContextType Context>
+    static auto deserialize(Context& context, T& value, const std::string&) -> void
+    {
+        auto& reader = context.template stream<BinaryReader>();
+        const auto length = readVarint<std::size_t>(reader);
+        auto [buffer, bytes] = reader.takeShared(length);
+        value = T { std::move(buffer), bytes };
+    }
+
+    static auto size(const T& value) -> std::size_t
+    {
+        return varintSize(value.size()) + value.size();
+    }
+};
+
+template<typename T>
+class CompactBinarySerializer<T, std::enable_if_t<std::is_base_of_v<Serializable, T>>>
+    : public CompactBinarySerializerBase
+{
+public:
+    template<SerializationContextType Context>
+    static auto serialize(Context& context, const T& object, const std::string&) -> void
+    {
+        object.serialize(context);
+    }
+
+    template<SerializationContextType Context>
+    static auto deserialize(Context& context, T& object, const std::string&) -> void
+    {
+        object.deserialize(context);
+    }
+};
+
+template<>
+struct SerializerTraits<CompactBinarySerializer>
+{
+    using Input = BinaryReader;
+    using Output = BinaryWriter;
+};
+
+namespace compact {
+
+template<SerializationContextType Context, typename T>
+inline auto serialize(Context& context, const T& value) -> void
+{
+    CompactBinarySerializer<T>::serialize(context, value, "");
+}
+
+template<SerializationContextType Context, typename T>
+inline auto deserialize(Context& context, T& value) -> void
+{
+    CompactBinarySerializer<T>::deserialize(context, value, "");
+}
+
+template<typename T>
+inline auto size(const T& value) -> std::size_t
+{
+    return CompactBinarySerializer<T>::size(value);
+}
+
+} // namespace compact
+} // namespace isml
+
+#endif // ISML_COMPACT_BINARY_SERIALIZER_HPP
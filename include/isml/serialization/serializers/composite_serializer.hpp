@@ -7,7 +7,8 @@
 #ifndef ISML_COMPOSITE_SERIALIZER_HPP
 #define ISML_COMPOSITE_SERIALIZER_HPP
 
-#include <typeinfo>
+#include <string>
+#include <type_traits>
 
 #include <isml/exceptions.hpp>
 #include <isml/serialization/serialization_context.hpp>
@@ -17,6 +18,13 @@ namespace isml {
 /**
  * @class   CompositeSerializer
  * @brief   Used to compose serializers.
+ *
+ *          A TypedSerializationContext is dispatched at compile time. A
+ *          type-erased context is matched against the serializers without
+ *          RTTI; if it is actually a typed one, the value is encoded through
+ *          the typed context and everything nested in it is dispatched
+ *          statically.
+ *
  * @tparam  Serializers
  * @since   0.1.4
  */
@@ -25,20 +33,21 @@ template<template<typename...> typename... Serializers>
 class CompositeSerializer
 {
 public:
-    template<typename T>
-    static auto serialize(SerializationContext& context, const T& value, const std::string& name) -> void;
+    template<SerializationContextType Context, typename T>
+    static auto serialize(Context& context, const T& value, const std::string& name) -> void;
 
-    template<typename T>
-    static auto deserialize(SerializationContext& context, T& value, const std::string& name) -> void;
+    template<SerializationContextType Context, typename T>
+    static auto deserialize(Context& context, T& value, const std::string& name) -> void;
 
 protected:
-    static auto supportedBy(SerializationContext& context) noexcept -> bool;
+    template<typename Tag>
+    static constexpr bool supports = (std::is_same_v<Tag, SerializerTag<Serializers>> or ...);
 
     template<template<typename...> typename Serializer, typename T>
-    static auto serializeUsing(SerializationContext& context, const T& value, const std::string& name) -> void;
+    static auto serializeUsing(SerializationContext& context, const T& value, const std::string& name) -> bool;
 
     template<template<typename...> typename Serializer, typename T>
-    static auto deserializeUsing(SerializationContext& context, T& value, const std::string& name) -> void;
+    static auto deserializeUsing(SerializationContext& context, T& value, const std::string& name) -> bool;
 };
 
 template<typename T>
@@ -47,46 +56,78 @@ struct IsCompositeSerializer : std::false_type {};
 template<template<typename...> typename... Ts>
 struct IsCompositeSerializer<CompositeSerializer<Ts...>> : std::true_type {};
 
-template<template<typename...> typename... Serializers>
-template<typename T>
-auto CompositeSerializer<Serializers...>::serialize(SerializationContext& context, const T& value, const std::string& name) -> void
-{
-    if (!supportedBy(context))
-        throw IOException("Serializer is not supported");
+/// Checks if the composite serializer includes the serializer.
+template<typename Composite, template<typename...> typename Serializer>
+struct CompositeSerializerIncludes : std::false_type {};
 
-    (serializeUsing<Serializers>(context, value, name), ...);
-}
+template<template<typename...> typename... Ts, template<typename...> typename Serializer>
+struct CompositeSerializerIncludes<CompositeSerializer<Ts...>, Serializer>
+    : std::bool_constant<(std::is_same_v<SerializerTag<Ts>, SerializerTag<Serializer>> or ...)> {};
 
 template<template<typename...> typename... Serializers>
-template<typename T>
-auto CompositeSerializer<Serializers...>::deserialize(SerializationContext& context, T& value, const std::string& name) -> void
+template<SerializationContextType Context, typename T>
+auto CompositeSerializer<Serializers...>::serialize(Context& context, const T& value, const std::string& name) -> void
 {
-    if (!supportedBy(context))
-        throw IOException("Serializer is not supported");
-
-    (deserializeUsing<Serializers>(context, value, name), ...);
+    if constexpr (IsTypedSerializationContext<Context>::value)
+    {
+        if constexpr (supports<typename Context::Tag>)
+            Context::template SerializerFor<T>::serialize(context, value, name);
+        else
+            throw IOException("Serializer is not supported");
+    }
+    else
+    {
+        if (!(serializeUsing<Serializers>(context, value, name) or ...))
+            throw IOException("Serializer is not supported");
+    }
 }
 
 template<template<typename...> typename... Serializers>
-inline auto CompositeSerializer<Serializers...>::supportedBy(SerializationContext& context) noexcept -> bool
+template<SerializationContextType Context, typename T>
+auto CompositeSerializer<Serializers...>::deserialize(Context& context, T& value, const std::string& name) -> void
 {
-    return ((typeid(SerializerTag<Serializers>) == context.serializerTag()) || ...);
+    if constexpr (IsTypedSerializationContext<Context>::value)
+    {
+        if constexpr (supports<typename Context::Tag>)
+            Context::template SerializerFor<T>::deserialize(context, value, name);
+        else
+            throw IOException("Serializer is not supported");
+    }
+    else
+    {
+        if (!(deserializeUsing<Serializers>(context, value, name) or ...))
+            throw IOException("Serializer is not supported");
+    }
 }
 
 template<template<typename...> typename... Serializers>
 template<template<typename...> typename Serializer, typename T>
-inline auto CompositeSerializer<Serializers...>::serializeUsing(SerializationContext& context, const T& value, const std::string& name) -> void
+inline auto CompositeSerializer<Serializers...>::serializeUsing(SerializationContext& context, const T& value, const std::string& name) -> bool
 {
-    if (context.serializerTag() == typeid(SerializerTag<Serializer>))
+    if (!context.uses<Serializer>())
+        return false;
+
+    if (auto* typed = context.typedAs<Serializer, typename SerializerTraits<Serializer>::Output>())
+        Serializer<T>::serialize(*typed, value, name);
+    else
         Serializer<T>::serialize(context, value, name);
+
+    return true;
 }
 
 template<template<typename...> typename... Serializers>
 template<template<typename...> typename Serializer, typename T>
-inline auto CompositeSerializer<Serializers...>::deserializeUsing(SerializationContext& context, T& value, const std::string& name) -> void
+inline auto CompositeSerializer<Serializers...>::deserializeUsing(SerializationContext& context, T& value, const std::string& name) -> bool
 {
-    if (context.serializerTag() == typeid(SerializerTag<Serializer>))
+    if (!context.uses<Serializer>())
+        return false;
+
+    if (auto* typed = context.typedAs<Serializer, typename SerializerTraits<Serializer>::Input>())
+        Serializer<T>::deserialize(*typed, value, name);
+    else
         Serializer<T>::deserialize(context, value, name);
+
+    return true;
 }
 
 } // namespace isml
@@ -0,0 +1,442 @@
+/**
+ * @file    json_stream_serializer.hpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#ifndef ISML_JSON_STREAM_SERIALIZER_HPP
+#define ISML_JSON_STREAM_SERIALIZER_HPP
+
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <isml/exceptions.hpp>
+
+#include <isml/base/concepts.hpp>
+#include <isml/base/type_traits.hpp>
+
+#include <isml/serialization/json_io.hpp>
+#include <isml/serialization/serializable.hpp>
+#include <isml/serialization/serializer_traits.hpp>
+
+namespace isml {
+namespace json {
+
+template<SerializationContextType Context, typename T>
+auto write(Context& context, const T& value) -> void;
+
+template<SerializationContextType Context, typename T>
+auto read(Context& context, T& value) -> void;
+
+} // namespace json
+
+template<typename T, typename P = void>
+class JsonStreamSerializer;
+
+/**
+ * @class   JsonStreamSerializerBase
+ * @brief   Names the values written by the JSON serializers.
+ *
+ *          A value is written as a member of the enclosing object (a
+ *          Serializable) under the field name, or as an item if it is nested
+ *          in a container. The specializations only define how the value
+ *          itself is written (write) and read (read).
+ * @since   0.1.7
+ */
+
+template<typename T>
+class JsonStreamSerializerBase
+{
+public:
+    template<SerializationContextType Context>
+    static auto serialize(Context& context, const T& value, const std::string& name) -> void
+    {
+        context.template stream<JsonWriter>().key(name);
+        JsonStreamSerializer<T>::write(context, value);
+    }
+
+    template<SerializationContextType Context>
+    static auto deserialize(Context& context, T& value, const std::string& name) -> void
+    {
+        context.template stream<JsonReader>().member(name);
+        JsonStreamSerializer<T>::read(context, value);
+    }
+
+protected:
+    ~JsonStreamSerializerBase() = default;
+};
+
+template<>
+class JsonStreamSerializer<bool>
+    : public JsonStreamSerializerBase<bool>
+{
+public:
+    template<SerializationContextType Context>
+    static auto write(Context& context, bool value) -> void
+    {
+        context.template stream<JsonWriter>().writeBool(value);
+    }
+
+    template<SerializationContextType Context>
+    static auto read(Context& context, bool& value) -> void
+    {
+        value = context.template stream<JsonReader>().readBool();
+    }
+};
+
+template<typename T>
+class JsonStreamSerializer<T, std::enable_if_t<std::is_integral_v<T> and !std::is_same_v<T, bool>>>
+    : public JsonStreamSerializerBase<T>
+{
+public:
+    template<SerializationContextType Context>
+    static auto write(Context& context, T value) -> void
+    {
+        context.template stream<JsonWriter>().writeInteger(value);
+    }
+
+    template<SerializationContextType Context>
+    static auto read(Context& context, T& value) -> void
+    {
+        value = context.template stream<JsonReader>().template readInteger<T>();
+    }
+};
+
+/**
+ * @brief   Non-finite numbers have no JSON representation and are written as
+ *          null, which is read back as NaN.
+ */
+
+template<typename T>
+class JsonStreamSerializer<T, std::enable_if_t<std::is_floating_point_v<T>>>
+    : public JsonStreamSerializerBase<T>
+{
+public:
+    template<SerializationContextType Context>
+    static auto write(Context& context, T value) -> void
+    {
+        context.template stream<JsonWriter>().writeFloat(value);
+    }
+
+    template<SerializationContextType Context>
+    static auto read(Context& context, T& value) -> void
+    {
+        value = context.template stream<JsonReader>().template readFloat<T>();
+    }
+};
+
+template<typename T>
+class JsonStreamSerializer<T, std::enable_if_t<std::is_enum_v<T>>>
+    : public JsonStreamSerializerBase<T>
+{
+public:
+    template<SerializationContextType Context>
+    static auto write(Context& context, T enumerator) -> void
+    {
+        context.template stream<JsonWriter>().writeInteger(static_cast<std::underlying_type_t<T>>(enumerator));
+    }
+
+    template<SerializationContextType Context>
+    static auto read(Context& context, T& enumerator) -> void
+    {
+        auto& reader = context.template stream<JsonReader>();
+        enumerator = static_cast<T>(reader.template readInteger<std::underlying_type_t<T>>());
+    }
+};
+
+/// Pairs are written as arrays of two items.
+template<typename T>
+class JsonStreamSerializer<T, std::enable_if_t<IsPair<T>::value>>
+    : public JsonStreamSerializerBase<T>
+{
+public:
+    template<SerializationContextType Context>
+    static auto write(Context& context, const T& pair) -> void
+    {
+        auto& writer = context.template stream<JsonWriter>();
+        writer.beginArray();
+        writer.key({});
+        json::write(context, pair.first);
+        writer.key({});
+        json::write(context, pair.second);
+        writer.endArray();
+    }
+
+    template<SerializationContextType Context>
+    static auto read(Context& context, T& pair) -> void
+    {
+        auto& reader = context.template stream<JsonReader>();
+        reader.beginArray();
+        if (!reader.nextItem())
+            throw IOException("Invalid JSON pair");
+        json::read(context, pair.first);
+        if (!reader.nextItem())
+            throw IOException("Invalid JSON pair");
+        json::read(context, pair.second);
+        reader.endArray();
+    }
+};
+
+/// An empty optional is written as null.
+template<typename T>
+class JsonStreamSerializer<T, std::enable_if_t<IsOptional<T>::value>>
+    : public JsonStreamSerializerBase<T>
+{
+public:
+    template<SerializationContextType Context>
+    static auto write(Context& context, const T& optional) -> void
+    {
+        if (optional.has_value())
+            json::write(context, *optional);
+        else
+            context.template stream<JsonWriter>().writeNull();
+    }
+
+    template<SerializationContextType Context>
+    static auto read(Context& context, T& optional) -> void
+    {
+        if (context.template stream<JsonReader>().readNull())
+        {
+            optional.reset();
+            return;
+        }
+
+        typename T::value_type value;
+        json::read(context, value);
+        optional = std::make_optional(std::move(value));
+    }
+};
+
+/// Strings are written as JSON strings, other containers as arrays.
+template<typename T>
+class JsonStreamSerializer<T, std::enable_if_t<SequenceContainer<T>>>
+    : public JsonStreamSerializerBase<T>
+{
+public:
+    template<SerializationContextType Context>
+    static auto write(Context& context, const T& container) -> void
+    {
+        auto& writer = context.template stream<JsonWriter>();
+        if constexpr (std::is_same_v<T, std::string>)
+        {
+            writer.writeString(container);
+        }
+        else
+        {
+            writer.beginArray();
+            for (const auto& item : container)
+            {
+                writer.key({});
+                json::write(context, item);
+            }
+            writer.endArray();
+        }
+    }
+
+    template<SerializationContextType Context>
+    static auto read(Context& context, T& container) -> void
+    {
+        auto& reader = context.template stream<JsonReader>();
+        if constexpr (std::is_same_v<T, std::string>)
+        {
+            reader.readString(container);
+        }
+        else
+        {
+            container.clear();
+            reader.beginArray();
+            while (reader.nextItem())
+            {
+                typename T::value_type item;
+                json::read(context, item);
+                container.push_back(std::move(item));
+            }
+            reader.endArray();
+        }
+    }
+};
+
+/**
+ * @brief   Maps with string keys are written as objects, other maps as
+ *          arrays of [key, value] pairs, sets as arrays.
+ */
+
+template<typename T>
+class JsonStreamSerializer<T, std::enable_if_t<AssociativeContainer<T>>>
+    : public JsonStreamSerializerBase<T>
+{
+public:
+    template<SerializationContextType Context>
+    static auto write(Context& context, const T& container) -> void
+    {
+        auto& writer = context.template stream<JsonWriter>();
+        if constexpr (k_object)
+        {
+            writer.beginObject();
+            for (const auto& [key, value] : container)
+            {
+                writer.key(key);
+                json::write(context, value);
+            }
+            writer.endObject();
+        }
+        else
+        {
+            writer.beginArray();
+            for (const auto& item : container)
+            {
+                writer.key({});
+                json::write(context, item);
+            }
+            writer.endArray();
+        }
+    }
+
+    template<SerializationContextType Context>
+    static auto read(Context& context, T& container) -> void
+    {
+        auto& reader = context.template stream<JsonReader>();
+        container.clear();
+        if constexpr (k_object)
+        {
+            reader.beginObject();
+            std::string key;
+            while (reader.nextMember(key))
+            {
+                typename T::mapped_type value;
+                json::read(context, value);
+                container.insert(std::make_pair(key, std::move(value)));
+            }
+            reader.endObject();
+        }
+        else
+        {
+            reader.beginArray();
+            while (reader.nextItem())
+            {
+                if constexpr (Map<T>)
+                {
+                    std::pair<typename T::key_type, typename T::mapped_type> item;
+                    json::read(context, item);
+                    container.insert(std::move(item));
+                }
+                else
+                {
+                    typename T::key_type key;
+                    json::read(context, key);
+                    container.insert(std::move(key));
+                }
+            }
+            reader.endArray();
+        }
+    }
+
+protected:
+    static constexpr bool k_object = [] {
+        if constexpr (Map<T>)
+            return std::is_same_v<typename T::key_type, std::string>;
+        else
+            return false;
+    }();
+};
+
+template<typename T>
+class JsonStreamSerializer<T, std::enable_if_t<IsArray<T>::value>>
+    : public JsonStreamSerializerBase<T>
+{
+public:
+    template<SerializationContextType Context>
+    static auto write(Context& context, const T& array) -> void
+    {
+        auto& writer = context.template stream<JsonWriter>();
+        writer.beginArray();
+        for (const auto& item : array)
+        {
+            writer.key({});
+            json::write(context, item);
+        }
+        writer.endArray();
+    }
+
+    template<SerializationContextType Context>
+    static auto read(Context& context, T& array) -> void
+    {
+        auto& reader = context.template stream<JsonReader>();
+        reader.beginArray();
+        for (auto& item : array)
+        {
+            if (!reader.nextItem())
+                throw IOException("Invalid JSON array size");
+            json::read(context, item);
+        }
+        if (reader.nextItem())
+            throw IOException("Invalid JSON array size");
+        reader.endArray();
+    }
+};
+
+/// Serializable objects are written as JSON objects, their fields as members.
+template<typename T>
+class JsonStreamSerializer<T, std::enable_if_t<std::is_base_of_v<Serializable, T>>>
+    : public JsonStreamSerializerBase<T>
+{
+public:
+    template<SerializationContextType Context>
+    static auto write(Context& context, const T& object) -> void
+    {
+        auto& writer = context.template stream<JsonWriter>();
+        writer.beginObject();
+        object.serialize(context);
+        writer.endObject();
+    }
+
+    template<SerializationContextType Context>
+    static auto read(Context& context, T& object) -> void
+    {
+        auto& reader = context.template stream<JsonReader>();
+        reader.beginObject();
+        object.deserialize(context);
+        reader.endObject();
+    }
+};
+
+template<>
+struct SerializerTraits<JsonStreamSerializer>
+{
+    using Input = JsonReader;
+    using Output = JsonWriter;
+};
+
+namespace json {
+
+template<SerializationContextType Context, typename T>
+inline auto write(Context& context, const T& value) -> void
+{
+    JsonStreamSerializer<T>::write(context, value);
+}
+
+template<SerializationContextType Context, typename T>
+inline auto read(Context& context, T& value) -> void
+{
+    JsonStreamSerializer<T>::read(context, value);
+}
+
+/// Writes a value as a JSON document.
+template<SerializationContextType Context, typename T>
+inline auto serialize(Context& context, const T& value) -> void
+{
+    JsonStreamSerializer<T>::serialize(context, value, "");
+}
+
+/// Reads a value from a JSON document.
+template<SerializationContextType Context, typename T>
+inline auto deserialize(Context& context, T& value) -> void
+{
+    JsonStreamSerializer<T>::deserialize(context, value, "");
+}
+
+} // namespace json
+} // namespace isml
+
+#endif // ISML_JSON_STREAM_SERIALIZER_HPP
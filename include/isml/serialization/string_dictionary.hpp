@@ -0,0 +1,119 @@
+/**
+ * @file    string_dictionary.hpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#ifndef ISML_STRING_DICTIONARY_HPP
+#define ISML_STRING_DICTIONARY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace isml {
+
+/**
+ * @class   StringDictionary
+ * @brief   Bounded dictionary of strings used to send repeated strings as
+ *          identifiers.
+ *
+ *          The encoding side interns strings: the first occurrence of a
+ *          string is assigned an identifier (replacing the least recently used
+ *          string when the dictionary is full) and sent along with it, later
+ *          occurrences are sent as the identifier only. The decoding side
+ *          follows the definitions it receives, so both dictionaries stay in
+ *          sync as long as the strings are decoded in the order they were
+ *          encoded. A decoding side which has missed definitions (e.g. a
+ *          message was dropped) clears the dictionary: the identifiers
+ *          defined since then are known to be right and the others are
+ *          rejected until they are defined again.
+ *
+ * @since   0.1.7
+ */
+
+class StringDictionary
+{
+public:
+    using Id = std::uint16_t;
+
+    static constexpr std::size_t k_max_capacity = 0x7FFFU;
+    static constexpr std::size_t k_default_capacity = 4096U;
+    static constexpr std::size_t k_default_max_length = 64U;
+
+    struct Lookup
+    {
+        Id   id       {};
+        bool inserted {};  ///< The string is new and must be sent along with the identifier.
+    };
+
+public:
+
+    /**
+     * @param   capacity    Maximum number of strings (up to k_max_capacity).
+     * @param   max_length  Maximum length of an interned string.
+     */
+
+    explicit StringDictionary(std::size_t capacity = k_default_capacity,
+                              std::size_t max_length = k_default_max_length);
+
+    // non-copyable (the index refers to the stored strings)
+    StringDictionary(const StringDictionary&) = delete;
+    auto operator=(const StringDictionary&) -> StringDictionary& = delete;
+
+public:
+
+    /// Checks if the string is worth interning (not empty and not too long).
+    auto accepts(std::string_view value) const noexcept -> bool;
+
+    /**
+     * @brief   Finds the string or assigns an identifier to it (encoding side).
+     */
+
+    auto intern(std::string_view value) -> Lookup;
+
+    /**
+     * @brief   Stores the string received with the identifier (decoding side).
+     *
+     * @throw   IOException  If the identifier exceeds the capacity.
+     */
+
+    auto define(Id id, std::string_view value) -> void;
+
+    /**
+     * @brief   Returns the string having the identifier (decoding side).
+     *
+     * @throw   IOException  If the identifier isn't defined.
+     */
+
+    auto at(Id id) const -> const std::string&;
+
+    /// Forgets all the strings.
+    auto clear() noexcept -> void;
+
+    auto size() const noexcept -> std::size_t;
+    auto capacity() const noexcept -> std::size_t;
+
+protected:
+    struct Entry
+    {
+        std::string             value   {};
+        std::list<Id>::iterator recency {};
+        bool                    defined {};
+    };
+
+protected:
+    std::size_t                              m_capacity;
+    std::size_t                              m_max_length;
+    std::vector<Entry>                       m_entries    {};  ///< Indexed by the identifier.
+    std::list<Id>                            m_recency    {};  ///< The most recently used first.
+    std::unordered_map<std::string_view, Id> m_ids        {};  ///< Views the stored strings.
+};
+
+} // namespace isml
+
+#endif // ISML_STRING_DICTIONARY_HPP
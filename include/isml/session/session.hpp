@@ -8,6 +8,7 @@
 #define ISML_SESSION_HPP
 
 #include <memory>
+#include <mutex>
 #include <optional>
 
 #include <isml/base_types.hpp>
@@ -17,6 +18,7 @@
 #include <isml/transport/transport.hpp>
 
 #include <isml/session/session_base.hpp>
+#include <isml/session/session_capabilities.hpp>
 
 namespace isml {
 
@@ -62,6 +64,16 @@ public:
 
     auto transport() noexcept -> std::unique_ptr<Transport>&;
 
+    /**
+     * @brief   Gets the features negotiated with the peer.
+     *
+     * @return  Nothing if the handshake is disabled or not completed yet.
+     */
+
+    auto capabilities() const -> std::optional<SessionCapabilities>;
+
+    auto setCapabilities(const SessionCapabilities& capabilities) -> void;
+
 public:
     Properties properties {};
 
@@ -69,6 +81,9 @@ private:
     const SessionId            m_id;         ///< Session identifier.
     std::unique_ptr<Transport> m_transport;  ///< Message transport.
 
+    std::optional<SessionCapabilities> m_capabilities       {};  ///< Negotiated features.
+    mutable std::mutex                 m_capabilities_guard {};
+
     friend class SessionFactory;
 };
 
@@ -0,0 +1,59 @@
+/**
+ * @file    session_capabilities.hpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#ifndef ISML_SESSION_CAPABILITIES_HPP
+#define ISML_SESSION_CAPABILITIES_HPP
+
+#include <cstdint>
+#include <limits>
+
+#include <isml/base_types.hpp>
+
+namespace isml {
+
+/**
+ * @class   SessionCapabilities
+ * @brief   Features of the wire format supported by a peer. The peers
+ *          exchange their capabilities on session open and keep the
+ *          negotiated (mutually supported) set.
+ * @since   0.1.7
+ */
+
+struct SessionCapabilities
+{
+    enum Codec : std::uint32_t
+    {
+        Binary        = 0x01U,
+        CompactBinary = 0x02U
+    };
+
+    static constexpr std::uint16_t k_protocol_version = 1U;
+
+    std::uint16_t version            { k_protocol_version };
+    std::uint32_t codecs             { Codec::Binary | Codec::CompactBinary };  ///< Codec flags.
+    std::uint32_t max_frame_size     { std::numeric_limits<MessageLength>::max() };
+    std::uint64_t schema_fingerprint {};  ///< See MessageFactory::fingerprint.
+    bool          schema_match       {};  ///< Both peers registered the same descriptors.
+
+    auto supports(Codec codec) const noexcept -> bool;
+
+    /// Gets the capabilities of this peer.
+    static auto local() -> SessionCapabilities;
+
+    /**
+     * @brief   Gets the features supported by both peers.
+     *
+     * @param   local   Capabilities of this peer.
+     * @param   remote  Capabilities received from the other peer.
+     */
+
+    static auto negotiate(const SessionCapabilities& local, const SessionCapabilities& remote) noexcept
+        -> SessionCapabilities;
+};
+
+} // namespace isml
+
+#endif // ISML_SESSION_CAPABILITIES_HPP
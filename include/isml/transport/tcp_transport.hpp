@@ -11,6 +11,15 @@
 #include <unordered_map>
 #include <chrono>
 #include <mutex>
+#include <shared_mutex>
+#include <functional>
+#include <system_error>
+#include <atomic>
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+#include <limits>
 
 ISML_DISABLE_WARNINGS_PUSH
 #   include <boost/asio/ip/tcp.hpp>
@@ -20,7 +29,22 @@ ISML_DISABLE_WARNINGS_POP
 
 #include <isml/message/message_queue.hpp>
 
+#include <isml/net/socket_error_queue.hpp>
+#include <isml/net/socket_timestamping.hpp>
+
+#include <isml/serialization/binary_io.hpp>
+#include <isml/serialization/string_dictionary.hpp>
+
+#include <isml/session/session_capabilities.hpp>
+
+#include <isml/task/task_executor.hpp>
+
+#include <isml/utility/buffer_pool.hpp>
+#include <isml/utility/shared_buffer.hpp>
+
 #include <isml/transport/transport.hpp>
+#include <isml/transport/transport_options.hpp>
+#include <isml/transport/transport_statistics.hpp>
 
 namespace isml {
 
@@ -29,6 +53,60 @@ using TcpSocket = boost::asio::ip::tcp::socket;
 /**
  * @class   TcpTransport
  * @brief   A message transport working over a TCP connection.
+ *
+ *          Frame layout: message length (excluding the length itself),
+ *          credit grant (only if the flow control is enabled), stream header
+ *          (only if the multiplexing is enabled), message type and message
+ *          fields. A frame without the message type and fields carries only
+ *          the credit grant.
+ *
+ *          With the multiplexing enabled every stream has its own outgoing
+ *          queue and the transport writes one chunk of at most
+ *          @c max_chunk_size bytes per stream in turn, so a large message
+ *          doesn't hold back the other streams. The stream header consists
+ *          of the stream identifier and flags (the first and the last chunk
+ *          of a message).
+ *
+ *          Without the multiplexing a message larger than
+ *          TransportOptions::k_max_chunk_size is split as well. Its frames
+ *          start with the @c k_chunked_frame marker followed by the frame
+ *          length, and the chunk flags follow the credit grant.
+ *
+ *          With the frame checksum enabled every frame ends with the CRC-32C
+ *          of the frame (from the length prefix to the checksum), verified
+ *          before anything in the frame is used. A frame failing the check is
+ *          dropped and counted (TransportStatistics::checksum_failures), and
+ *          so are the partially received messages of the multiplexed streams
+ *          up to their next first chunk. The credits the frame would return
+ *          to the peer are returned anyway (a message credit if the stream is
+ *          unknown), while the credits granted in it are lost.
+ *
+ *          With the timestamping enabled the transport reads the socket with
+ *          recvmsg() to collect receive timestamps (see Message::timestamps)
+ *          and reports transmit timestamps from the socket error queue to the
+ *          listeners (TransportListener::onMessageTransmitted).
+ *
+ *          With the zero-copy threshold set, frames of at least the threshold
+ *          size are sent with MSG_ZEROCOPY. Their buffers are kept until the
+ *          kernel reports the completion and then returned to the pool.
+ *
+ *          By default messages are encoded by the write loop. In the caller
+ *          and executor encoding modes they are encoded into pooled buffers
+ *          before being queued, so the socket executor only frames and
+ *          writes ready bytes. Likewise, in the executor decoding mode
+ *          complete frames are handed to the decoding executor, which creates
+ *          the messages and delivers them in order.
+ *
+ *          With the handshake enabled the first message of each peer is the
+ *          hello message (@c k_hello_message_type) carrying its capabilities.
+ *          The negotiated ones are stored on the session.
+ *
+ *          With the flow control enabled the transport stops writing when
+ *          the credits granted by the peer are exhausted. The credits are
+ *          returned to the peer as the application takes messages from the
+ *          incoming queue, piggybacked on outgoing frames or, if nothing is
+ *          sent for a while, in a separate frame once half of the window is
+ *          accumulated.
  */
 
 class TcpTransport : public Transport
@@ -36,14 +114,117 @@ class TcpTransport : public Transport
 public:
     using Clock = std::chrono::high_resolution_clock;
     using Timestamp = Clock::time_point;
-    using ByteBuffer = std::unique_ptr<char[]>;
     using Request = std::promise<Message::Ptr>;
     using PendingRequests = std::unordered_map<MessageId, Request>;
     using PendingRequestsTs = std::unordered_map<MessageId, Timestamp>;
+    using IoHandler = std::function<void(const std::error_code&, std::size_t)>;
+    using CreditGrant = std::uint32_t;
+    using FrameFlags = std::uint8_t;
+
+    static constexpr FrameFlags k_last_chunk = 0x01U;
+    static constexpr FrameFlags k_first_chunk = 0x02U;
+
+    /// Length prefix marking a chunk of a message split without the multiplexing.
+    static constexpr MessageLength k_chunked_frame = std::numeric_limits<MessageLength>::max();
+
+    /// Type of the first message sent with the handshake enabled.
+    static constexpr MessageType k_hello_message_type = k_reserved_msg_type;
+
+    /// Kinds of messages written after the message type in the delta mode.
+    using DeltaKind = std::uint8_t;
+
+    static constexpr DeltaKind k_keyframe = 0x00U;     ///< All the fields.
+    static constexpr DeltaKind k_delta_frame = 0x01U;  ///< Fields changed since the previous message.
+
+    struct DeltaBase
+    {
+        Message::Ptr  message {};  ///< The last message of the type sent/received on the stream.
+        std::uint32_t count   {};  ///< Number of messages encoded since the keyframe.
+    };
+
+    /// Keyed by the stream and the message type (see deltaKey()).
+    using DeltaBases = std::unordered_map<std::uint32_t, DeltaBase>;
+
+    /// Flags written after the message type with the string dictionary enabled.
+    using DictionaryFlags = std::uint8_t;
+
+    /// The dictionary of the stream is cleared before the message is decoded.
+    static constexpr DictionaryFlags k_dictionary_reset = 0x01U;
+
+    struct StreamStrings
+    {
+        explicit StreamStrings(std::size_t capacity)
+            : dictionary(capacity)
+        {}
+
+        StringDictionary dictionary;
+        std::uint32_t    count {};  ///< Number of messages encoded since the reset.
+    };
+
+    /// Strings are interned per stream, since the streams are decoded in
+    /// another order than they were encoded in.
+    using StringDictionaries = std::unordered_map<StreamId, StreamStrings>;
+
+    struct OutgoingMessage
+    {
+        Message::Ptr       message   {};  ///< Set if the message is to be encoded by the write loop.
+        BufferPool::Buffer data      {};  ///< Encoded message (type and fields).
+        std::size_t        size      {};
+        MessageId          id        {};
+        StreamId           stream_id {};
+    };
+
+    /// Shared with the tasks of the encoding and decoding executors, which
+    /// may run after the transport is stopped.
+    struct TaskGuard
+    {
+        std::shared_mutex mutex   {};  ///< Held shared by the running tasks, exclusively by doStop.
+        std::atomic<bool> stopped {};  ///< The tasks return at once, the transport may be gone.
+    };
+
+    using TaskMethod = void (TcpTransport::*)();
+
+    struct IncomingFrame
+    {
+        SharedBuffer     data       {};  ///< Frame (or reassembled chunks) the message lies within.
+        std::string_view message    {};  ///< Encoded message (type and fields).
+        StreamId         stream_id  {};
+        CreditGrant      cost       {};  ///< Credits returned once the message is consumed.
+        SocketTimestamp  timestamp  {};
+        bool             lost       {};  ///< The message was dropped, the decoding state of the stream is reset.
+        bool             any_stream {};  ///< The dropped message may belong to any stream.
+    };
+
+    struct OutgoingStream
+    {
+        std::deque<OutgoingMessage> messages {};
+        OutgoingMessage             current  {};  ///< Message being sent.
+        std::size_t                 offset   {};  ///< Number of bytes of the message already sent.
+    };
+
+    struct PendingTransmit
+    {
+        MessageId                id      {};
+        std::chrono::nanoseconds written {};
+    };
+    using PendingTransmits = std::map<std::uint32_t, PendingTransmit>;
+
+    struct ZeroCopyBuffer
+    {
+        BufferPool::Buffer buffer    {};
+        std::uint32_t      last_call {};  ///< The last send call using the buffer.
+    };
+
+    using ZeroCopyBuffers = std::deque<ZeroCopyBuffer>;
+
+    static constexpr std::size_t k_max_pending_transmits = 4096U;
+
+    using OutgoingStreams = std::map<StreamId, OutgoingStream>;
+    using IncomingStreams = std::map<StreamId, std::string>;
 
 public:
     TcpTransport() = delete;
-    explicit TcpTransport(TcpSocket socket);
+    explicit TcpTransport(TcpSocket socket, TransportOptions options = {});
     TcpTransport(const TcpTransport&) = delete;
 
     auto operator=(const TcpTransport&) -> TcpTransport& = delete;
@@ -51,19 +232,206 @@ public:
 public:
     auto removeExpiredRequests() -> void override;
 
+    auto options() const noexcept -> const TransportOptions&;
+
+    auto statistics() const noexcept -> const TransportStatistics&;
+
+    /**
+     * @brief   Sets the executor encoding outgoing messages in the
+     *          Encoding::Executor mode. Must be set before the transport is
+     *          started; without it messages are encoded by the caller.
+     */
+
+    auto setEncodingExecutor(std::shared_ptr<TaskExecutor> executor) noexcept -> void;
+
+    /**
+     * @brief   Sets the executor decoding incoming messages in the
+     *          Decoding::Executor mode. Must be set before the transport is
+     *          started; without it messages are decoded by the read loop.
+     */
+
+    auto setDecodingExecutor(std::shared_ptr<TaskExecutor> executor) noexcept -> void;
+
 protected:
+
+    /**
+     * @brief   Starts the write loop on the socket executor unless it is
+     *          already running. Safe to call from any thread.
+     */
+
+    auto scheduleWrite() -> void;
     auto writeMessage() -> void;
+    auto writePending() const -> bool;
+    auto outgoingPending() const -> bool;
+    auto pushOutgoing(OutgoingMessage msg) -> void;
+
+    /**
+     * @brief   Starts draining the encoding queue on the encoding executor
+     *          unless it is already running. Messages are encoded one at a
+     *          time, so they keep the order they were sent in.
+     */
+
+    auto scheduleEncoding() -> void;
+    auto encodePending() -> void;
+
+    /**
+     * @brief   Runs the method of the transport on an executor unless the
+     *          transport has been stopped. Static, as the transport may be
+     *          destroyed by then.
+     */
+
+    static auto runTask(TcpTransport* transport, const std::shared_ptr<TaskGuard>& guard, TaskMethod task) -> void;
+
+    /**
+     * @brief   Encodes the message type and fields into a pooled buffer.
+     */
+
+    auto encodeMessage(const Message& msg) -> OutgoingMessage;
+
+    /**
+     * @brief   Encodes the message on the calling thread and queues it.
+     *          With the delta encoding or the string dictionary enabled the
+     *          messages are queued in the order they were encoded.
+     */
+
+    auto pushEncoded(const Message& msg) -> void;
+
+    /**
+     * @brief   Encodes the hello message carrying the local capabilities.
+     */
+
+    auto encodeHello() -> OutgoingMessage;
+
+    auto creditsEnabled() const noexcept -> bool;
+    auto creditCost(std::size_t payload_length, bool last_chunk) const noexcept -> CreditGrant;
+    auto creditThreshold() const noexcept -> CreditGrant;
+
+    /**
+     * @brief   Returns credits to the peer for the data consumed locally.
+     */
+
+    auto grantCredits(CreditGrant credits) -> void;
+
+    /**
+     * @brief   Takes the credits accumulated for the peer.
+     *
+     * @param   standalone  The grant would be sent without a message, so
+     *                      small amounts are held back.
+     */
+
+    auto takeCreditGrant(bool standalone) -> CreditGrant;
 
     auto readMessageLength() ->void;
     auto readMessage() -> void;
     auto onMessageRead() -> void;
-    auto createMessageFromStream(std::stringstream& stream) -> Maybe<Message::Ptr>;
 
-    auto resizeIncomingDataBuffer() -> void;
+    /**
+     * @brief   Verifies and strips the checksum of the frame read.
+     *
+     * @return  false if the frame is corrupted and has been dropped.
+     */
+
+    auto verifyChecksum() -> bool;
+
+    /**
+     * @brief   Starts draining the decoding queue on the decoding executor
+     *          unless it is already running. Frames are decoded one at a
+     *          time, so messages are delivered in the order they arrived.
+     */
+
+    auto scheduleDecoding() -> void;
+    auto decodePending() -> void;
+
+    /**
+     * @brief   Creates the message from the frame and delivers it to the
+     *          incoming queue or the pending request.
+     */
+
+    auto decodeFrame(IncomingFrame frame) -> void;
+
+    /// Decodes the frame on the decoding executor or at once.
+    auto dispatchFrame(IncomingFrame frame) -> void;
+
+    /**
+     * @brief   Makes the decoding of the stream (or all of them) recover from
+     *          a dropped message: the delta frames are dropped until the next
+     *          keyframe and the strings received before are forgotten (see
+     *          dropReceivedStrings()).
+     */
+
+    auto resetDecoding(Maybe<StreamId> stream_id) -> void;
+    auto createMessageFromReader(BinaryReader& reader, StreamId stream_id) -> Maybe<Message::Ptr>;
+    auto onHello(const SessionCapabilities& remote) -> void;
+
+    /// Takes the block the frame is read into from the receive pool.
+    auto acquireIncomingFrame() -> void;
     auto resizeOutgoingDataBuffer() -> void;
 
     auto disconnected(const std::error_code& ec) -> bool;
 
+    auto streamStrings(StringDictionaries& dictionaries, StreamId stream_id) -> StreamStrings&;
+
+    /**
+     * @brief   Forgets the strings received on the stream, as a message which
+     *          hasn't been decoded may have redefined any of them. The
+     *          messages referring to the strings defined before are dropped
+     *          until the sender resets the dictionary.
+     */
+
+    auto dropReceivedStrings(StreamId stream_id) -> void;
+
+    static auto deltaKey(StreamId stream_id, MessageType type) noexcept -> std::uint32_t;
+
+    /**
+     * @brief   Reads exactly the given number of bytes collecting the receive
+     *          timestamps of the data.
+     */
+
+    auto receiveTimestamped(boost::asio::mutable_buffer buffer, IoHandler handler, std::size_t transferred) -> void;
+
+    /**
+     * @brief   Waits for notifications in the socket error queue (transmit
+     *          timestamps and zero-copy completions).
+     */
+
+    auto waitErrorQueue() -> void;
+    auto onTransmitted(const TransmitTimestamp& transmitted) -> void;
+    auto onZeroCopyCompleted(const ZeroCopyCompletion& completion) -> void;
+
+    /**
+     * @brief   Writes the outgoing frame starting at the given offset with
+     *          MSG_ZEROCOPY, copying if the kernel runs out of pinned memory.
+     */
+
+    auto writeZeroCopy(std::size_t offset, IoHandler handler) -> void;
+
+    /**
+     * @brief   Keeps the outgoing frame buffer until the kernel is done with it.
+     */
+
+    auto retainZeroCopyBuffer() -> void;
+
+    /**
+     * @brief   Reads exactly the given number of bytes from the connection.
+     *          Overridden by transports layering a protocol over the socket.
+     */
+
+    virtual auto asyncRead(boost::asio::mutable_buffer buffer, IoHandler handler) -> void;
+
+    /**
+     * @brief   Writes the whole buffer to the connection.
+     *          Overridden by transports layering a protocol over the socket.
+     */
+
+    virtual auto asyncWrite(boost::asio::const_buffer buffer, IoHandler handler) -> void;
+
+    /**
+     * @brief   Ends the connection before the socket is closed (see doStop).
+     *          Overridden by transports layering a protocol over the socket.
+     */
+
+    virtual auto shutdownConnection() -> void;
+
 private:
     // Interface: Service
     auto doStart() -> void override;
@@ -76,18 +444,58 @@ private:
     auto doRequest(Message::Ptr msg) -> FutureMessage override;
 
 protected:
-    TcpSocket               m_socket;
-    PendingRequests         m_pending_requests      {};
-    PendingRequestsTs       m_pending_requests_ts   {};
-    std::mutex              m_pending_requests_mtx  {};
-
-    ConcurrentMessageQueue  m_outgoing_messages     {};
-    ByteBuffer              m_outgoing_data_buffer  {};
-    MessageLength           m_outgoing_data_length  {};
-
-    ConcurrentMessageQueue  m_incoming_messages     {};
-    ByteBuffer              m_incoming_data_buffer  {};
-    MessageLength           m_incoming_data_length  {};
+    TcpSocket                     m_socket;
+    TransportOptions              m_options;
+    TransportStatistics           m_statistics            {};
+    PendingRequests               m_pending_requests      {};
+    PendingRequestsTs             m_pending_requests_ts   {};
+    std::mutex                    m_pending_requests_mtx  {};
+
+    std::deque<OutgoingMessage>   m_outgoing_queue        {};
+    mutable std::mutex            m_outgoing_guard        {};
+    ConcurrentMessageQueue        m_encoding_queue        {};  ///< Messages waiting for the encoding executor.
+    std::shared_ptr<TaskExecutor> m_encoding_executor     {};
+    std::atomic<bool>             m_encoding_scheduled    {};
+    DeltaBases                    m_sent_bases            {};  ///< Accessed by the encoding thread only.
+    StringDictionaries            m_sent_strings          {};  ///< Accessed by the encoding thread only.
+    std::mutex                    m_delta_guard           {};  ///< Orders the encoding callers (delta, dictionary).
+    BufferPool                    m_buffer_pool           {};
+    BufferPool::Buffer            m_outgoing_data_buffer  {};
+    MessageLength                 m_outgoing_data_length  {};
+    std::atomic<bool>             m_write_in_progress     {};
+    OutgoingStreams               m_outgoing_streams      {};  ///< Accessed from the socket executor only.
+    std::deque<StreamId>          m_ready_streams         {};  ///< Streams having data to send, in turn.
+
+    ConcurrentMessageQueue        m_incoming_messages     {};
+    SharedBuffer                  m_incoming_frame        {};  ///< Frame being read, handed over to the decoder as is.
+    MessageLength                 m_incoming_data_length  {};
+    bool                          m_incoming_chunked      {};  ///< The frame being read is marked with k_chunked_frame.
+    std::deque<CreditGrant>       m_incoming_costs        {};  ///< Credits of the queued messages.
+    std::mutex                    m_incoming_guard        {};
+    IncomingStreams               m_incoming_streams      {};  ///< Messages being reassembled.
+    std::shared_ptr<BufferPool>   m_receive_pool          { std::make_shared<BufferPool>() };  ///< Frames, kept by the messages referring to them.
+    std::deque<IncomingFrame>     m_decoding_queue        {};  ///< Frames waiting for the decoding executor.
+    std::mutex                    m_decoding_guard        {};
+    std::shared_ptr<TaskExecutor> m_decoding_executor     {};
+    std::atomic<bool>             m_decoding_scheduled    {};
+    std::shared_ptr<TaskGuard>    m_task_guard            { std::make_shared<TaskGuard>() };
+    DeltaBases                    m_received_bases        {};  ///< Accessed by the decoding thread only.
+    StringDictionaries            m_received_strings      {};  ///< Accessed by the decoding thread only.
+
+    SocketTimestamp               m_rx_timestamp          {};  ///< Timestamp of the last received data.
+    SocketTimestamp               m_frame_timestamp       {};  ///< Timestamp of the frame being read.
+    PendingTransmits              m_pending_transmits     {};  ///< Keyed by the offset of the frame end.
+    std::uint32_t                 m_transmit_offset       {};
+
+    ZeroCopyBuffers               m_zero_copy_buffers     {};  ///< Buffers pinned by the kernel.
+    std::uint32_t                 m_zero_copy_calls       {};  ///< Number of zero-copy send calls.
+    std::uint32_t                 m_zero_copy_completed   {};  ///< Send calls before this one are all completed.
+    std::vector<ZeroCopyCompletion> m_zero_copy_ahead     {};  ///< Completions reported before those of earlier calls.
+    std::uint32_t                 m_frame_zero_copy_calls {};  ///< Zero-copy send calls of the current frame.
+
+    std::int64_t                  m_send_credits          {};  ///< Accessed from the socket executor only.
+    bool                          m_send_stalled          {};
+    std::atomic<CreditGrant>      m_pending_grant         {};  ///< Credits to be returned to the peer.
 };
 
 } // namespace isml
@@ -14,6 +14,7 @@ ISML_DISABLE_WARNINGS_PUSH
 ISML_DISABLE_WARNINGS_POP
 
 #include <isml/transport/transport_factory.hpp>
+#include <isml/transport/tcp_transport.hpp>
 
 namespace isml {
 
@@ -27,6 +28,18 @@ public:
     auto createTransport(const Url& url) noexcept -> Result<Transport::Ptr, std::error_code> override;
     auto supports(const std::string& protocol) const noexcept -> bool override;
 
+protected:
+
+    /**
+     * @brief   Resolves the host specified in the URL and connects to it.
+     *
+     * @param   url  Target URL.
+     *
+     * @return  If successful - connected socket, otherwise - error code.
+     */
+
+    auto connect(const Url& url) noexcept -> Result<TcpSocket, std::error_code>;
+
 protected:
     std::reference_wrapper<boost::asio::io_context> m_ioc;
 };
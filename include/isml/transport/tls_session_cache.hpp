@@ -0,0 +1,81 @@
+/**
+ * @file    tls_session_cache.hpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#ifndef ISML_TLS_SESSION_CACHE_HPP
+#define ISML_TLS_SESSION_CACHE_HPP
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+ISML_DISABLE_WARNINGS_PUSH
+#   include <openssl/ssl.h>
+ISML_DISABLE_WARNINGS_POP
+
+namespace isml {
+
+/**
+ * @class   TlsSessionCache
+ * @brief   Client-side storage of TLS sessions (tickets) keyed by the remote
+ *          endpoint, used to resume sessions on reconnect without a full
+ *          handshake.
+ * @since   0.1.7
+ */
+
+class TlsSessionCache
+{
+public:
+    using SessionPtr = std::unique_ptr<SSL_SESSION, decltype(&SSL_SESSION_free)>;
+    using Sessions = std::unordered_map<std::string, SessionPtr>;
+
+public:
+    TlsSessionCache() = default;
+
+    // non-copyable
+    TlsSessionCache(const TlsSessionCache&) = delete;
+    auto operator=(const TlsSessionCache&) -> TlsSessionCache& = delete;
+
+public:
+
+    /**
+     * @brief   Enables client session caching on the given SSL context and
+     *          routes new sessions (including TLS 1.3 post-handshake tickets)
+     *          to the cache bound to the connection.
+     *
+     * @param   context  Native SSL context.
+     */
+
+    static auto attach(SSL_CTX* context) noexcept -> void;
+
+    /**
+     * @brief   Binds the connection to the cache: offers the cached session
+     *          for the given key (if any) and stores tickets received later.
+     *
+     * @param   ssl  Native connection handle (before the handshake).
+     * @param   key  Endpoint key the connection belongs to.
+     */
+
+    auto bind(SSL* ssl, const std::string& key) -> void;
+
+    /**
+     * @brief   Stores the session for the given key taking ownership of it.
+     */
+
+    auto store(const std::string& key, SSL_SESSION* session) -> void;
+
+    auto contains(const std::string& key) const -> bool;
+
+    auto erase(const std::string& key) -> void;
+
+protected:
+    Sessions           m_sessions       {};
+    mutable std::mutex m_sessions_guard {};
+};
+
+} // namespace isml
+
+#endif // ISML_TLS_SESSION_CACHE_HPP
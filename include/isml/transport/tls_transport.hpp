@@ -0,0 +1,158 @@
+/**
+ * @file    tls_transport.hpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#ifndef ISML_TLS_TRANSPORT_HPP
+#define ISML_TLS_TRANSPORT_HPP
+
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <system_error>
+
+ISML_DISABLE_WARNINGS_PUSH
+#   include <boost/asio/ssl/context.hpp>
+#   include <boost/asio/ssl/stream.hpp>
+ISML_DISABLE_WARNINGS_POP
+
+#include <isml/base/result.hpp>
+
+#include <isml/transport/tcp_transport.hpp>
+#include <isml/transport/tls_session_cache.hpp>
+
+namespace isml {
+
+/**
+ * @class   TlsTransport
+ * @brief   A message transport working over a TLS connection.
+ *
+ *          The record layer is handled by Boost.Asio SSL in user space. If the
+ *          kernel offload is requested and the kernel accepts both directions
+ *          of the connection (kTLS), the handshake is performed by OpenSSL
+ *          directly on the socket and afterwards the transport talks to the
+ *          socket as plain TCP: encryption happens in the kernel and sends
+ *          don't pass through user-space TLS buffers.
+ *
+ *          Stopping the transport sends the close_notify alert, so the
+ *          session of a client stays resumable. The alert of the peer isn't
+ *          waited for.
+ *
+ *          The socket timestamping and zero-copy sending are not supported.
+ * @since   0.1.7
+ */
+
+class TlsTransport : public TcpTransport
+{
+public:
+    using SslContext = boost::asio::ssl::context;
+    using SslStream = boost::asio::ssl::stream<TcpSocket&>;
+    using HandshakeType = boost::asio::ssl::stream_base::handshake_type;
+    using NativeSsl = std::unique_ptr<SSL, decltype(&SSL_free)>;
+    using HandshakeHandler = std::function<void(const std::error_code&)>;
+    using AcceptHandler = std::function<void(Result<Transport::Ptr, std::error_code>)>;
+
+    /// Time the stop waits for the close_notify alert to be sent.
+    static constexpr std::chrono::milliseconds k_close_notify_timeout { 100 };
+
+public:
+    TlsTransport() = delete;
+    TlsTransport(TcpSocket socket, SslContext& context, TransportOptions options = {});
+    TlsTransport(const TlsTransport&) = delete;
+
+    auto operator=(const TlsTransport&) -> TlsTransport& = delete;
+
+public:
+
+    /**
+     * @brief   Enables session resumption using the given cache. Must be
+     *          called before the handshake.
+     *
+     * @param   cache  Session cache.
+     * @param   key    Endpoint key the connection belongs to.
+     */
+
+    auto setSessionCache(std::shared_ptr<TlsSessionCache> cache, std::string key) -> void;
+
+    /**
+     * @brief   Performs the TLS handshake synchronously. Must be called before
+     *          the transport is started.
+     *
+     * @param   type      Client or server side of the handshake.
+     * @param   hostname  Expected peer name (client side, may be empty).
+     * @param   ktls      Try to offload the record layer to the kernel.
+     *
+     * @note    A connection established for the offload can't fall back to
+     *          the user-space record layer. If the kernel refuses it, check
+     *          kernelOffloaded() and reconnect without the offload (with the
+     *          session cache it is a cheap resumption).
+     *
+     * @return  Error code (empty on success).
+     */
+
+    auto handshake(HandshakeType type, const std::string& hostname, bool ktls) -> std::error_code;
+
+    /**
+     * @brief   Performs the TLS handshake on the socket executor without
+     *          blocking it. Must be called before the transport is started,
+     *          the transport must outlive the handshake.
+     *
+     * @param   type      Client or server side of the handshake.
+     * @param   hostname  Expected peer name (client side, may be empty).
+     * @param   handler   Called with the error code (empty on success).
+     *
+     * @note    The record layer stays in user space, the kernel offload is
+     *          negotiated by the blocking handshake() only.
+     */
+
+    auto asyncHandshake(HandshakeType type, const std::string& hostname, HandshakeHandler handler) -> void;
+
+    /**
+     * @brief   Creates a transport over the accepted connection and performs
+     *          the server side of the handshake asynchronously, so a slow
+     *          client doesn't stall the thread serving the connections.
+     *
+     * @param   socket   Accepted connection.
+     * @param   context  Server context, must outlive the transport.
+     * @param   options  Transport options.
+     * @param   handler  Called on the socket executor with the transport
+     *                   once the handshake succeeds, otherwise with the
+     *                   error code.
+     */
+
+    static auto asyncAccept(TcpSocket socket, SslContext& context, TransportOptions options, AcceptHandler handler) -> void;
+
+    /// Checks if the record layer is offloaded to the kernel in both directions.
+    auto kernelOffloaded() const noexcept -> bool;
+
+    /// Checks if the handshake resumed a previously established session.
+    auto sessionReused() const noexcept -> bool;
+
+protected:
+    auto asyncRead(boost::asio::mutable_buffer buffer, IoHandler handler) -> void override;
+    auto asyncWrite(boost::asio::const_buffer buffer, IoHandler handler) -> void override;
+    auto shutdownConnection() -> void override;
+
+    /// Sends the close_notify alert, runs on the socket executor.
+    auto sendCloseNotify() -> void;
+
+    auto kernelHandshake(HandshakeType type, const std::string& hostname) -> std::error_code;
+
+    auto prepare(SSL* ssl, HandshakeType type, const std::string& hostname) -> void;
+
+protected:
+    SslStream                           m_stream;
+    NativeSsl                           m_kernel_ssl     { nullptr, SSL_free }; ///< Connection in kTLS mode.
+    bool                                m_kernel_offload {};
+    bool                                m_session_reused {};
+    std::shared_ptr<TlsSessionCache>    m_session_cache  {};
+    std::string                         m_session_key    {};
+    std::shared_ptr<std::promise<void>> m_close_notify   {}; ///< Fulfilled once the alert is sent.
+};
+
+} // namespace isml
+
+#endif // ISML_TLS_TRANSPORT_HPP
@@ -0,0 +1,55 @@
+/**
+ * @file    tls_transport_factory.hpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#ifndef ISML_TLS_TRANSPORT_FACTORY_HPP
+#define ISML_TLS_TRANSPORT_FACTORY_HPP
+
+#include <functional>
+#include <memory>
+
+ISML_DISABLE_WARNINGS_PUSH
+#   include <boost/asio/ssl/context.hpp>
+ISML_DISABLE_WARNINGS_POP
+
+#include <isml/transport/tcp_transport_factory.hpp>
+#include <isml/transport/tls_session_cache.hpp>
+
+namespace isml {
+
+/**
+ * @class   TlsTransportFactory
+ * @brief   Creates TLS transports for URLs like tls://host:port.
+ *
+ *          Supported URL parameters:
+ *          - ktls=1 - offload the record layer to the kernel if possible.
+ *
+ *          Sessions are cached per endpoint, so reconnects are resumed.
+ * @since   0.1.7
+ */
+
+class TlsTransportFactory : public TcpTransportFactory
+{
+public:
+    TlsTransportFactory() = delete;
+    TlsTransportFactory(boost::asio::io_context& ioc, boost::asio::ssl::context& context) noexcept;
+
+public:
+    auto createTransport(const Url& url) noexcept -> Result<Transport::Ptr, std::error_code> override;
+    auto supports(const std::string& protocol) const noexcept -> bool override;
+
+    auto sessionCache() noexcept -> TlsSessionCache&;
+
+protected:
+    auto createTransport(const Url& url, bool ktls) noexcept -> Result<Transport::Ptr, std::error_code>;
+
+protected:
+    std::reference_wrapper<boost::asio::ssl::context> m_context;
+    std::shared_ptr<TlsSessionCache>                  m_session_cache;
+};
+
+} // namespace isml
+
+#endif // ISML_TLS_TRANSPORT_FACTORY_HPP
@@ -7,7 +7,11 @@
 #ifndef ISML_TRANSPORT_LISTENER_HPP
 #define ISML_TRANSPORT_LISTENER_HPP
 
+#include <chrono>
 #include <system_error>
+
+#include <isml/base_types.hpp>
+#include <isml/net/socket_timestamping.hpp>
 #include <isml/service/service.hpp>
 
 namespace isml {
@@ -31,6 +35,20 @@ public:
 public:
     virtual auto onStateChanged(Transport& transport, State from, State to) -> void = 0;
     virtual auto onErrorOccurred(Transport& transport, const std::error_code& ec) -> void = 0;
+
+    /**
+     * @brief   Called when the kernel reports transmission of a message (only
+     *          if the timestamping is enabled).
+     *
+     * @param   transport    Transport.
+     * @param   id           Message identifier.
+     * @param   written      Time the message was handed to the socket.
+     * @param   transmitted  Transmit timestamp.
+     */
+
+    virtual auto onMessageTransmitted(Transport& /*transport*/, MessageId /*id*/,
+        std::chrono::nanoseconds /*written*/, const SocketTimestamp& /*transmitted*/) -> void
+    {}
 };
 
 } // namespace isml
@@ -0,0 +1,193 @@
+/**
+ * @file    transport_options.hpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#ifndef ISML_TRANSPORT_OPTIONS_HPP
+#define ISML_TRANSPORT_OPTIONS_HPP
+
+#include <cstdint>
+#include <limits>
+
+#include <isml/base_types.hpp>
+
+#include <isml/net/url.hpp>
+
+namespace isml {
+
+/**
+ * @class   FlowControl
+ * @brief   Defines units of the credits the receiving peer grants to the
+ *          sending one.
+ */
+
+enum class FlowControl
+{
+    None,       ///< The peer is never blocked.
+    Messages,   ///< One credit per message.
+    Bytes       ///< One credit per byte of a frame.
+};
+
+/**
+ * @class   Timestamping
+ * @brief   Defines sources of the socket timestamps collected by a transport.
+ */
+
+enum class Timestamping
+{
+    None,
+    Software,   ///< Kernel timestamps.
+    Hardware    ///< Network adapter timestamps (kernel ones if not available).
+};
+
+/**
+ * @class   Codec
+ * @brief   Defines the encoding of messages on the wire.
+ */
+
+enum class Codec
+{
+    Binary,         ///< Fixed-width integers (BinarySerializer).
+    CompactBinary   ///< Varint integers (CompactBinarySerializer).
+};
+
+/**
+ * @class   Encoding
+ * @brief   Defines where outgoing messages are encoded.
+ */
+
+enum class Encoding
+{
+    IoThread,   ///< The write loop encodes messages on the socket executor.
+    Caller,     ///< The thread sending a message encodes it.
+    Executor    ///< The encoding executor (see TcpTransport::setEncodingExecutor).
+};
+
+/**
+ * @class   Decoding
+ * @brief   Defines where incoming messages are decoded.
+ */
+
+enum class Decoding
+{
+    IoThread,   ///< The read loop decodes messages on the socket executor.
+    Executor    ///< The decoding executor (see TcpTransport::setDecodingExecutor).
+};
+
+/**
+ * @class   TransportOptions
+ * @brief   Connection options shared by both peers of a message transport.
+ *
+ *          Both peers must be configured identically since the options
+ *          affect the frame layout. On the client side the options are taken
+ *          from the URL parameters:
+ *
+ *          - @c credits=messages|bytes  enables the credit-based flow control;
+ *          - @c window=N                initial number of credits (the amount
+ *                                       of data a peer may have in flight);
+ *          - @c streams=1               enables multiplexing of logical streams
+ *                                       (see Message::streamId);
+ *          - @c chunk=N                 maximum number of message bytes in a
+ *                                       frame of a multiplexed connection;
+ *          - @c timestamps=software|hardware  enables the socket timestamping
+ *                                       (see Message::timestamps);
+ *          - @c zerocopy=N              sends frames of at least N bytes with
+ *                                       MSG_ZEROCOPY (0 - disabled);
+ *          - @c codec=binary|compact    encoding of messages (the message
+ *                                       fields must be registered with the
+ *                                       corresponding serializer);
+ *          - @c presence=1              omits message fields holding default
+ *                                       values, marking the written ones in
+ *                                       a presence bitmap;
+ *          - @c delta=1                 encodes only the fields changed since
+ *                                       the previous message of the type on
+ *                                       the stream;
+ *          - @c keyframe=N              sends every N-th message of a type in
+ *                                       full in the delta mode and resets the
+ *                                       string dictionary of a stream every N
+ *                                       messages (0 - only the first one);
+ *          - @c indexed=1               precedes message fields with a table
+ *                                       of their offsets; received messages
+ *                                       decode each field on the first
+ *                                       access and are forwarded by copying
+ *                                       the unmodified fields (see
+ *                                       Message::serializeIndexed); can't be
+ *                                       combined with presence, delta or
+ *                                       dictionary;
+ *          - @c dictionary=N            sends repeated strings as identifiers
+ *                                       of a dictionary of N strings (binary
+ *                                       codec only, see StringDictionary);
+ *                                       a message which isn't decoded (e.g.
+ *                                       of a type unknown to the receiver)
+ *                                       makes the receiver drop the messages
+ *                                       referring to the earlier strings
+ *                                       until the next reset (see keyframe);
+ *          - @c crc=1                   appends the CRC-32C of every frame;
+ *                                       frames failing the check are dropped
+ *                                       and counted (see TransportStatistics);
+ *          - @c handshake=1             exchanges the capabilities with the
+ *                                       peer on session open (see
+ *                                       Session::capabilities);
+ *          - @c encode=io|caller|executor  where outgoing messages are encoded;
+ *          - @c decode=io|executor      where incoming messages are decoded;
+ *          - @c accounting=1            measures the CPU time spent encoding,
+ *                                       writing and decoding (see
+ *                                       TransportStatistics).
+ *
+ *          The encoding, decoding and accounting options are local to a peer.
+ *
+ * @since   0.1.7
+ */
+
+struct TransportOptions
+{
+    static constexpr std::uint32_t k_default_message_window = 64U;
+    static constexpr std::uint32_t k_default_byte_window = 1024U * 1024U;
+    static constexpr std::uint32_t k_default_chunk_size = 16U * 1024U;
+    static constexpr std::uint32_t k_default_keyframe_interval = 64U;
+
+    // Leaves room for the frame header
+    static constexpr std::uint32_t k_max_chunk_size = std::numeric_limits<MessageLength>::max() - 64U;
+
+    FlowControl   flow_control        { FlowControl::None };
+    std::uint32_t credit_window       { 0U };
+    bool          multiplexing        { false };
+    std::uint32_t max_chunk_size      { k_default_chunk_size };
+    Timestamping  timestamping        { Timestamping::None };
+    std::uint32_t zero_copy_threshold { 0U };
+    Codec         codec               { Codec::Binary };
+    bool          field_presence      { false };
+    bool          delta_encoding      { false };
+    std::uint32_t keyframe_interval   { k_default_keyframe_interval };
+    bool          indexed_layout      { false };
+    std::uint32_t string_dictionary   { 0U };
+    bool          frame_checksum      { false };
+    bool          handshake           { false };
+    Encoding      encoding            { Encoding::IoThread };
+    Decoding      decoding            { Decoding::IoThread };
+    bool          accounting          { false };
+
+    /**
+     * @brief   Reads the options from the URL parameters.
+     *
+     * @param   url  Target URL.
+     *
+     * @throw   std::invalid_argument  If a parameter value is invalid.
+     */
+
+    static auto fromUrl(const Url& url) -> TransportOptions;
+
+    /**
+     * @brief   Creates options enabling the credit-based flow control.
+     *
+     * @param   mode    Credit units.
+     * @param   window  Initial number of credits (0 - use the default one).
+     */
+
+    static auto withCredits(FlowControl mode, std::uint32_t window = 0U) -> TransportOptions;
+};
+
+} // namespace isml
+
+#endif // ISML_TRANSPORT_OPTIONS_HPP
@@ -0,0 +1,48 @@
+/**
+ * @file    transport_statistics.hpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#ifndef ISML_TRANSPORT_STATISTICS_HPP
+#define ISML_TRANSPORT_STATISTICS_HPP
+
+#include <atomic>
+#include <cstdint>
+
+namespace isml {
+
+/**
+ * @class   TransportStatistics
+ * @brief   Counters of a message transport. Updated by the transport and
+ *          safe to read from any thread.
+ * @since   0.1.7
+ */
+
+struct TransportStatistics
+{
+    using Counter = std::atomic<std::uint64_t>;
+
+    Counter messages_sent       {};
+    Counter messages_received   {};
+    Counter bytes_sent          {};  ///< Including framing.
+    Counter bytes_received      {};  ///< Including framing.
+    Counter credit_stalls       {};  ///< Times the sender ran out of credits.
+    Counter credit_frames       {};  ///< Frames sent only to grant credits.
+    Counter rx_timestamps       {};  ///< Messages received with a socket timestamp.
+    Counter rx_delay_ns         {};  ///< Total time from the socket timestamp to decoding.
+    Counter tx_timestamps       {};  ///< Messages transmitted with a socket timestamp.
+    Counter tx_delay_ns         {};  ///< Total time from the write request to the socket timestamp.
+    Counter zero_copy_frames    {};  ///< Frames sent with MSG_ZEROCOPY.
+    Counter zero_copy_copied    {};  ///< Zero-copy sends the kernel completed by copying.
+    Counter zero_copy_fallbacks {};  ///< Zero-copy sends retried with copying (out of pinned memory).
+    Counter messages_encoded    {};  ///< Messages encoded with the accounting enabled.
+    Counter encode_cpu_ns       {};  ///< Total CPU time spent encoding messages (accounting only).
+    Counter write_cpu_ns        {};  ///< Total CPU time the write loop spent assembling frames (accounting only).
+    Counter decode_cpu_ns       {};  ///< Total CPU time spent decoding messages (accounting only).
+    Counter checksum_failures   {};  ///< Frames dropped because of a CRC mismatch.
+};
+
+} // namespace isml
+
+#endif // ISML_TRANSPORT_STATISTICS_HPP
@@ -0,0 +1,102 @@
+/**
+ * @file    buffer_pool.hpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#ifndef ISML_BUFFER_POOL_HPP
+#define ISML_BUFFER_POOL_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace isml {
+
+/**
+ * @class   BufferPool
+ * @brief   Thread-safe pool of byte buffers. Capacities are rounded up to
+ *          a power of two and released buffers are kept per capacity class
+ *          for reuse.
+ * @since   0.1.7
+ */
+
+class BufferPool
+{
+public:
+
+    /**
+     * @class   Buffer
+     * @brief   Uninitialized block of memory taken from the pool.
+     */
+
+    class Buffer
+    {
+    public:
+        Buffer() = default;
+        Buffer(Buffer&& other) noexcept;
+
+        auto operator=(Buffer&& other) noexcept -> Buffer&;
+
+        auto data() noexcept -> char*;
+        auto data() const noexcept -> const char*;
+        auto capacity() const noexcept -> std::size_t;
+
+        explicit operator bool() const noexcept;
+
+    private:
+        std::unique_ptr<char[]> m_data     {};
+        std::size_t             m_capacity {};
+
+        friend class BufferPool;
+    };
+
+    static constexpr std::size_t k_min_capacity_log2 = 6U;    ///< 64 bytes.
+    static constexpr std::size_t k_capacity_classes = 26U;    ///< Up to 2 GiB.
+
+public:
+    explicit BufferPool(std::size_t max_cached_buffers = 16U);
+
+    // non-copyable
+    BufferPool(const BufferPool&) = delete;
+    auto operator=(const BufferPool&) -> BufferPool& = delete;
+
+public:
+
+    /**
+     * @brief   Takes a buffer having at least the given capacity.
+     */
+
+    auto acquire(std::size_t size) -> Buffer;
+
+    /**
+     * @brief   Returns the buffer to the pool. The buffer is freed if the pool
+     *          already keeps enough buffers of its capacity.
+     */
+
+    auto release(Buffer buffer) noexcept -> void;
+
+    auto hits() const noexcept -> std::uint64_t;
+
+    auto misses() const noexcept -> std::uint64_t;
+
+protected:
+    static auto capacityClass(std::size_t size) noexcept -> std::size_t;
+
+protected:
+    using FreeList = std::vector<Buffer>;
+
+    const std::size_t                        m_max_cached_buffers;
+    std::array<FreeList, k_capacity_classes> m_free_lists         {};
+    std::mutex                               m_guard              {};
+    std::atomic<std::uint64_t>               m_hits               {};
+    std::atomic<std::uint64_t>               m_misses             {};
+};
+
+} // namespace isml
+
+#endif // ISML_BUFFER_POOL_HPP
@@ -0,0 +1,64 @@
+/**
+ * @file    crc32c.hpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#ifndef ISML_CRC32C_HPP
+#define ISML_CRC32C_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace isml {
+
+/**
+ * @class   Crc32c
+ * @brief   CRC-32C (Castagnoli) checksum.
+ *
+ *          On x86-64 processors supporting SSE4.2 the checksum is computed
+ *          with the crc32 instruction. Long buffers are split into three
+ *          interleaved lanes to hide the latency of the instruction, and the
+ *          lane checksums are combined with a carry-less multiplication
+ *          (PCLMULQDQ). On AArch64 the CRC extension is used if it is
+ *          enabled at compile time. Other processors use a table-driven
+ *          implementation (slicing by 8).
+ * @since   0.1.7
+ */
+
+class Crc32c final
+{
+public:
+    using Value = std::uint32_t;
+
+    Crc32c() = delete;
+
+public:
+
+    /**
+     * @brief   Computes the checksum of the data.
+     *
+     * @param   data  Data.
+     * @param   size  Data size.
+     * @param   crc   Checksum of the preceding data, if the data continues it.
+     */
+
+    static auto compute(const void* data, std::size_t size, Value crc = 0U) noexcept -> Value;
+    static auto compute(std::string_view data, Value crc = 0U) noexcept -> Value;
+
+    /// Computes the checksum with the table-driven implementation.
+    static auto computePortable(const void* data, std::size_t size, Value crc = 0U) noexcept -> Value;
+
+    /// Checks if the checksum is computed with the processor instructions.
+    static auto accelerated() noexcept -> bool;
+};
+
+inline auto Crc32c::compute(std::string_view data, Value crc) noexcept -> Value
+{
+    return compute(data.data(), data.size(), crc);
+}
+
+} // namespace isml
+
+#endif // ISML_CRC32C_HPP
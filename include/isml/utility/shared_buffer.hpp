@@ -0,0 +1,83 @@
+/**
+ * @file    shared_buffer.hpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#ifndef ISML_SHARED_BUFFER_HPP
+#define ISML_SHARED_BUFFER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+#include <isml/utility/buffer_pool.hpp>
+
+namespace isml {
+
+/**
+ * @class   SharedBuffer
+ * @brief   Reference-counted block of bytes, e.g. a received frame whose
+ *          bytes are referred to by the decoded values (see BorrowedString).
+ *          The block is taken from a buffer pool and returned to it when the
+ *          last reference is released; the pool is kept alive by the blocks.
+ *          Blocks created without a pool are freed.
+ *
+ *          The bytes are written through data() before the block is shared.
+ * @since   0.1.7
+ */
+
+class SharedBuffer
+{
+public:
+    SharedBuffer() = default;
+    SharedBuffer(const SharedBuffer& other) noexcept;
+    SharedBuffer(SharedBuffer&& other) noexcept;
+
+    ~SharedBuffer();
+
+    auto operator=(const SharedBuffer& other) noexcept -> SharedBuffer&;
+    auto operator=(SharedBuffer&& other) noexcept -> SharedBuffer&;
+
+public:
+
+    /**
+     * @brief   Creates an uninitialized block of the given size.
+     *
+     * @param   pool  Pool the block is taken from or nullptr.
+     * @param   size  Number of bytes.
+     */
+
+    static auto create(const std::shared_ptr<BufferPool>& pool, std::size_t size) -> SharedBuffer;
+
+    /// Creates a block holding a copy of the bytes.
+    static auto copy(const std::shared_ptr<BufferPool>& pool, std::string_view bytes) -> SharedBuffer;
+
+    auto data() noexcept -> char*;
+    auto data() const noexcept -> const char*;
+    auto size() const noexcept -> std::size_t;
+    auto view() const noexcept -> std::string_view;
+
+    /// Checks if the bytes lie within the block.
+    auto contains(std::string_view bytes) const noexcept -> bool;
+
+    /// Gets the number of references to the block.
+    auto references() const noexcept -> std::size_t;
+
+    auto reset() noexcept -> void;
+
+    explicit operator bool() const noexcept;
+
+protected:
+    struct Block;
+
+    explicit SharedBuffer(Block* block) noexcept;
+
+protected:
+    Block* m_block {};
+};
+
+} // namespace isml
+
+#endif // ISML_SHARED_BUFFER_HPP
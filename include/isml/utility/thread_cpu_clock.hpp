@@ -0,0 +1,40 @@
+/**
+ * @file    thread_cpu_clock.hpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#ifndef ISML_THREAD_CPU_CLOCK_HPP
+#define ISML_THREAD_CPU_CLOCK_HPP
+
+#include <chrono>
+#include <ctime>
+
+namespace isml {
+
+/**
+ * @class   ThreadCpuClock
+ * @brief   CPU time consumed by the calling thread.
+ * @since   0.1.7
+ */
+
+struct ThreadCpuClock
+{
+    using duration = std::chrono::nanoseconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<ThreadCpuClock>;
+
+    static constexpr bool is_steady = true;
+
+    static auto now() noexcept -> time_point
+    {
+        timespec ts {};
+        ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+        return time_point(std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec));
+    }
+};
+
+} // namespace isml
+
+#endif // ISML_THREAD_CPU_CLOCK_HPP
@@ -11,16 +11,22 @@
 namespace isml {
 
 Field::Field(const Field& other)
-    : m_name(other.m_name)
+    : m_own_name(other.m_own_name ? std::make_unique<const std::string>(*other.m_own_name) : nullptr)
+    , m_name(m_own_name ? m_own_name.get() : other.m_name)
 {}
 
-Field::Field(std::string name) noexcept
-    : m_name(std::move(name))
+Field::Field(std::string name)
+    : m_own_name(std::make_unique<const std::string>(std::move(name)))
+    , m_name(m_own_name.get())
+{}
+
+Field::Field(const std::string* name) noexcept
+    : m_name(name)
 {}
 
 auto Field::name() const noexcept -> const std::string&
 {
-    return m_name;
+    return *m_name;
 }
 
 } // namespace isml
@@ -27,4 +27,9 @@ auto FieldDescriptor::name() const noexcept -> const std::string&
     return m_name;
 }
 
+auto FieldDescriptor::fixedEncoding() const -> Maybe<FixedEncoding>
+{
+    return none;
+}
+
 } // namespace isml
@@ -0,0 +1,97 @@
+/**
+ * @file    field_layout.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#include <isml/message/field/field_layout.hpp>
+
+#include <algorithm>
+#include <utility>
+
+#include <isml/exceptions.hpp>
+#include <isml/io/format.hpp>
+#include <isml/serialization/serializers/binary_serializer.hpp>
+
+namespace isml {
+
+namespace {
+
+constexpr auto alignUp(std::size_t value, std::size_t alignment) noexcept -> std::size_t
+{
+    return (value + alignment - 1U) / alignment * alignment;
+}
+
+} // namespace
+
+FieldLayout::FieldLayout(Descriptors descriptors)
+    : m_descriptors(std::move(descriptors))
+{
+    m_offsets.reserve(m_descriptors.size());
+    m_indices.reserve(m_descriptors.size());
+
+    // The table of pointers to the fields goes first
+    m_storage_size = m_descriptors.size() * sizeof(Field*);
+
+    for (std::size_t index = 0U; index < m_descriptors.size(); ++index)
+    {
+        const auto& descriptor = *m_descriptors[index];
+        if (!m_indices.emplace(descriptor.name(), index).second)
+            throw InvalidArgumentException(fmt::format("Descriptor with same name ({}) has already been registered", descriptor.name()));
+
+        const auto alignment = descriptor.fieldAlignment();
+        m_storage_alignment = std::max(m_storage_alignment, alignment);
+        m_storage_size = alignUp(m_storage_size, alignment);
+        m_offsets.push_back(m_storage_size);
+        m_storage_size += descriptor.fieldSize();
+    }
+
+    m_storage_size = alignUp(m_storage_size, m_storage_alignment);
+
+    // A single variable-size field makes the whole layout generic
+    m_fixed_fields.reserve(m_descriptors.size());
+    for (std::size_t index = 0U; index < m_descriptors.size(); ++index)
+    {
+        const auto fixed_encoding = m_descriptors[index]->fixedEncoding();
+        if (fixed_encoding.isNone())
+        {
+            m_fixed_fields.clear();
+            m_fixed_size = 0U;
+            break;
+        }
+
+        const auto& encoding = *fixed_encoding;
+        if (encoding.counted)
+            m_fixed_size += sizeof(BinarySerializerBase::ContainerSize);
+
+        m_fixed_fields.push_back({
+            .storage_offset = m_offsets[index] + encoding.value_offset,
+            .wire_offset    = m_fixed_size,
+            .size           = encoding.size,
+            .element_size   = encoding.element_size,
+            .count          = encoding.count,
+            .counted        = encoding.counted,
+        });
+        m_fixed_size += encoding.size;
+    }
+}
+
+auto FieldLayout::extend(std::shared_ptr<const FieldDescriptor> descriptor) const -> Ptr
+{
+    if (m_indices.contains(descriptor->name()))
+        throw InvalidArgumentException(fmt::format("Descriptor with same name ({}) has already been registered", descriptor->name()));
+
+    auto descriptors = m_descriptors;
+    descriptors.push_back(std::move(descriptor));
+    return std::make_shared<const FieldLayout>(std::move(descriptors));
+}
+
+auto FieldLayout::indexOf(std::string_view name) const noexcept -> Maybe<std::size_t>
+{
+    Maybe<std::size_t> index { none };
+    if (const auto it = m_indices.find(name); it != m_indices.end())
+        index = it->second;
+    return index;
+}
+
+} // namespace isml
@@ -6,11 +6,272 @@
 
 #include <isml/message/field/field_set.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
 #include <utility>
-#include <iterator>
+
+#include <isml/exceptions.hpp>
+#include <isml/base/byte.hpp>
+#include <isml/serialization/binary_io.hpp>
+#include <isml/serialization/serializers/binary_serializer.hpp>
+#include <isml/utility/shared_buffer.hpp>
 
 namespace isml {
 
+namespace {
+
+constexpr auto bitmapSize(std::size_t field_count) noexcept -> std::size_t
+{
+    return (field_count + 7U) / 8U;
+}
+
+constexpr auto bitIsSet(const char* bitmap, std::size_t index) noexcept -> bool
+{
+    return (static_cast<unsigned char>(bitmap[index / 8U]) >> (index % 8U)) & 1U;
+}
+
+using FieldOffset = std::uint32_t;
+
+auto loadOffset(const char* table, std::size_t index) noexcept -> FieldOffset
+{
+    FieldOffset offset;
+    std::memcpy(&offset, table + index * sizeof offset, sizeof offset);
+    if constexpr (std::endian::native == std::endian::big)
+        ByteUtils::swap(offset);
+    return offset;
+}
+
+/// Swaps the bytes of the elements of a fixed field on big-endian hosts.
+auto swapElements(char* bytes, const FieldLayout::FixedField& field) noexcept -> void
+{
+    if constexpr (std::endian::native == std::endian::big)
+    {
+        if (field.element_size > 1U)
+        {
+            for (std::size_t index = 0U; index < field.count; ++index)
+                std::reverse(bytes + index * field.element_size, bytes + (index + 1U) * field.element_size);
+        }
+    }
+}
+
+auto usesFixedLayout(const FieldLayout::Ptr& layout, const SerializationContext& context) noexcept -> bool
+{
+    return layout and layout->fixed() and context.uses<BinarySerializer>();
+}
+
+/// Writes the values of the fields of a fixed layout at the precomputed offsets.
+auto serializeFixed(const FieldLayout& layout, const std::byte* storage, BinaryWriter& writer) -> void
+{
+    auto* bytes = writer.extend(layout.fixedSize());
+    for (const auto& field : layout.fixedFields())
+    {
+        if (field.counted)
+        {
+            auto count = static_cast<BinarySerializerBase::ContainerSize>(field.count);
+            if constexpr (std::endian::native == std::endian::big)
+                ByteUtils::swap(count);
+            std::memcpy(bytes + field.wire_offset - sizeof count, &count, sizeof count);
+        }
+
+        std::memcpy(bytes + field.wire_offset, storage + field.storage_offset, field.size);
+        swapElements(bytes + field.wire_offset, field);
+    }
+}
+
+/// Reads the values of the fields of a fixed layout from the precomputed offsets.
+auto deserializeFixed(const FieldLayout& layout, std::byte* storage, BinaryReader& reader) -> void
+{
+    const auto bytes = reader.take(layout.fixedSize());
+
+    // The counts are checked first, so a malformed message changes no value
+    for (const auto& field : layout.fixedFields())
+    {
+        if (!field.counted)
+            continue;
+
+        BinarySerializerBase::ContainerSize count;
+        std::memcpy(&count, bytes.data() + field.wire_offset - sizeof count, sizeof count);
+        if constexpr (std::endian::native == std::endian::big)
+            ByteUtils::swap(count);
+
+        if (count != field.count)
+            throw IOException("Element count doesn't match the array size");
+    }
+
+    for (const auto& field : layout.fixedFields())
+    {
+        auto* value = reinterpret_cast<char*>(storage + field.storage_offset);
+        std::memcpy(value, bytes.data() + field.wire_offset, field.size);
+        swapElements(value, field);
+    }
+}
+
+/// Writes a bitmap bit by bit (least significant first).
+class BitmapWriter
+{
+public:
+    explicit BitmapWriter(BinaryWriter& writer) noexcept
+        : m_writer(writer)
+    {}
+
+    auto push(bool bit) -> void
+    {
+        if (bit)
+            m_bits |= static_cast<unsigned char>(1U << (m_count % 8U));
+
+        if (++m_count % 8U == 0U)
+        {
+            m_writer.write(&m_bits, sizeof m_bits);
+            m_bits = 0U;
+        }
+    }
+
+    auto finish() -> void
+    {
+        if (m_count % 8U != 0U)
+            m_writer.write(&m_bits, sizeof m_bits);
+    }
+
+private:
+    BinaryWriter& m_writer;
+    unsigned char m_bits  {};
+    std::size_t   m_count {};
+};
+
+/// Allocates the storage of the layout with the reference count set to 1.
+auto allocateStorage(const FieldLayout& layout) -> std::byte*
+{
+    auto* storage = static_cast<std::byte*>(::operator new(layout.storageSize() + sizeof(std::atomic<std::size_t>),
+                                                           std::align_val_t { layout.storageAlignment() }));
+    new (storage + layout.storageSize()) std::atomic<std::size_t> { 1U };
+    return storage;
+}
+
+auto freeStorage(const FieldLayout& layout, std::byte* storage) noexcept -> void
+{
+    ::operator delete(storage, std::align_val_t { layout.storageAlignment() });
+}
+
+/// Fills the storage with the fields created by the function taking the field index and the address.
+template<typename CreateField>
+auto createFields(const FieldLayout& layout, CreateField&& create_field) -> std::byte*
+{
+    auto* storage = allocateStorage(layout);
+    auto** fields = reinterpret_cast<Field**>(storage);
+
+    std::size_t index = 0U;
+    try
+    {
+        for (; index < layout.size(); ++index)
+            fields[index] = create_field(index, storage + layout.offset(index));
+    }
+    catch (...)
+    {
+        while (index)
+            fields[--index]->~Field();
+        freeStorage(layout, storage);
+        throw;
+    }
+
+    return storage;
+}
+
+} // namespace
+
+/**
+ * @brief   Fields read by deserializeIndexed(): the offset table and the
+ *          encoded fields, the serializer they are decoded with and the state
+ *          of each field. Allocated at once with the states following the
+ *          header and shared by reference counting. The frame lies within
+ *          the backing buffer of the reader if there is one, so it isn't
+ *          copied and the borrowed fields refer to it.
+ */
+
+struct FieldSet::Retained
+{
+    enum State : std::uint8_t
+    {
+        Pending,    ///< Not decoded yet.
+        Decoding,   ///< Being decoded by one of the readers.
+        Decoded,    ///< Holds the value of the retained bytes.
+        Modified    ///< Accessed for modification, the retained bytes are stale.
+    };
+
+    using StateFlag = std::atomic<std::uint8_t>;
+
+    std::atomic<std::size_t> references { 1U };
+    SerializerBinding        binding;
+    std::size_t              count;   ///< Number of fields.
+    SharedBuffer             buffer;  ///< Buffer holding the frame.
+    std::string_view         frame;   ///< Offset table and the fields.
+
+    static auto create(const SerializerBinding& binding, std::size_t count, std::string_view frame,
+                       const SharedBuffer* backing) -> Retained*
+    {
+        const auto shared = backing and backing->contains(frame);
+        auto buffer = shared ? *backing : SharedBuffer::copy(nullptr, frame);
+        if (!shared)
+            frame = buffer.view();
+
+        auto* memory = static_cast<std::byte*>(::operator new(sizeof(Retained) + count * sizeof(StateFlag)));
+        auto* retained = new (memory) Retained { .binding = binding, .count = count,
+                                                 .buffer = std::move(buffer), .frame = frame };
+        for (std::size_t index = 0U; index < count; ++index)
+            new (memory + sizeof(Retained) + index * sizeof(StateFlag)) StateFlag { Pending };
+
+        return retained;
+    }
+
+    static auto release(Retained* retained) noexcept -> void
+    {
+        if (retained and retained->references.fetch_sub(1U, std::memory_order_acq_rel) == 1U)
+        {
+            retained->~Retained();
+            ::operator delete(retained);
+        }
+    }
+
+    auto state(std::size_t index) const noexcept -> StateFlag&
+    {
+        return reinterpret_cast<StateFlag*>(const_cast<Retained*>(this) + 1)[index];
+    }
+
+    /// Gets the encoded i-th field.
+    auto bytes(std::size_t index) const noexcept -> std::string_view
+    {
+        const auto* table = frame.data();
+        const auto begin = index ? loadOffset(table, index - 1U) : FieldOffset {};
+        return { table + count * sizeof(FieldOffset) + begin, loadOffset(table, index) - begin };
+    }
+
+    /// Gets the encoded fields without the offset table.
+    auto fields() const noexcept -> std::string_view
+    {
+        return frame.substr(count * sizeof(FieldOffset));
+    }
+
+    auto modified() const noexcept -> bool
+    {
+        for (std::size_t index = 0U; index < count; ++index)
+        {
+            if (state(index).load(std::memory_order_relaxed) == Modified)
+                return true;
+        }
+        return false;
+    }
+
+    /// Checks if the fields may be written by copying the retained bytes.
+    auto reusableBy(SerializationContext& context) const noexcept -> bool
+    {
+        return context.holds<BinaryWriter>() and context.uses(binding) and !context.dictionary();
+    }
+};
+
 FieldSet::FieldSet(const FieldSet& other)
 {
     assign(other);
@@ -21,6 +282,20 @@ FieldSet::FieldSet(FieldSet&& other) noexcept
     swap(other);
 }
 
+FieldSet::FieldSet(FieldLayout::Ptr layout)
+    : m_layout(std::move(layout))
+{
+    m_storage = createFields(*m_layout, [this](std::size_t index, std::byte* address)
+        {
+            return m_layout->descriptors()[index]->constructField(address);
+        });
+}
+
+FieldSet::~FieldSet()
+{
+    destroy();
+}
+
 auto FieldSet::operator=(const FieldSet& other) -> FieldSet&
 {
     if (this != &other)
@@ -41,83 +316,435 @@ auto FieldSet::operator=(FieldSet&& other) -> FieldSet&
     return *this;
 }
 
-auto FieldSet::add(Field::Ptr field) -> bool
+auto FieldSet::contains(const std::string& name) const noexcept -> bool
 {
-    if (m_fields_by_name.contains(field->name()))
-        return false;
-
-    const auto& name = field->name();
-    auto it = m_fields.empty() ? m_fields.begin() : std::prev(m_fields.end());
-    it = m_fields.insert(it, std::move(field));
-    m_fields_by_name.insert(std::make_pair(name, it));
-    return true;
+    return m_layout and m_layout->indexOf(name).isSome();
 }
 
-auto FieldSet::contains(const std::string& name) const noexcept -> bool
+auto FieldSet::get(const std::string& name) -> Maybe<Field&>
 {
-    return m_fields_by_name.contains(name);
+    Maybe<Field&> field { none };
+    if (!m_layout)
+        return field;
+
+    if (const auto index = m_layout->indexOf(name); index.isSome())
+        field = at(*index);
+    return field;
 }
 
-auto FieldSet::get(const std::string& name) -> Maybe<Field::Ptr&>
+auto FieldSet::get(const std::string& name) const -> Maybe<const Field&>
 {
-    Maybe<Field::Ptr&> field { none };
-    if (m_fields_by_name.contains(name))
-        field = *m_fields_by_name.at(name);
+    Maybe<const Field&> field { none };
+    if (!m_layout)
+        return field;
+
+    if (const auto index = m_layout->indexOf(name); index.isSome())
+        field = at(*index);
     return field;
 }
 
+auto FieldSet::layout() const noexcept -> const FieldLayout::Ptr&
+{
+    return m_layout;
+}
+
 auto FieldSet::empty() const noexcept -> bool
 {
-    return m_fields.empty();
+    return size() == 0U;
 }
 
 auto FieldSet::size() const noexcept -> std::size_t
 {
-    return m_fields.size();
+    return m_layout ? m_layout->size() : 0U;
 }
 
 auto FieldSet::assign(const FieldSet& other) -> void
 {
-    clear();
+    // The storage is shared until one of the field sets is modified
+    if (other.m_storage)
+        other.references().fetch_add(1U, std::memory_order_relaxed);
 
-    auto it = m_fields.begin();
-    for (const auto& field : other.m_fields)
-    {
-        it = m_fields.insert(it, field->clone());
-        m_fields_by_name.insert(std::make_pair(field->name(), it));
-    }
+    if (other.m_retained)
+        other.m_retained->references.fetch_add(1U, std::memory_order_relaxed);
+
+    destroy();
+    m_layout = other.m_layout;
+    m_storage = other.m_storage;
+    m_retained = other.m_retained;
 }
 
 auto FieldSet::swap(FieldSet& other) noexcept -> void
 {
-    std::swap(m_fields, other.m_fields);
-    std::swap(m_fields_by_name, other.m_fields_by_name);
+    std::swap(m_layout, other.m_layout);
+    std::swap(m_storage, other.m_storage);
+    std::swap(m_retained, other.m_retained);
 }
 
 auto FieldSet::clear() -> void
 {
-    m_fields.clear();
-    m_fields_by_name.clear();
+    destroy();
+}
+
+auto FieldSet::reset() -> void
+{
+    // Shared fields are replaced by new ones rather than copied and reset
+    if (shared())
+    {
+        FieldSet fields { m_layout };
+        swap(fields);
+        return;
+    }
+
+    for (std::size_t index = 0U; index < size(); ++index)
+        fields()[index]->reset();
+
+    dropRetained();
+}
+
+auto FieldSet::own() -> void
+{
+    // Fields still retained encoded refer to the frame, so they are owned
+    bool unowned = false;
+    for (std::size_t index = 0U; index < size() and !unowned; ++index)
+        unowned = fields()[index]->unowned();
+
+    if (!unowned)
+        return;
+
+    detach();
+    for (std::size_t index = 0U; index < size(); ++index)
+        fields()[index]->own();
+}
+
+auto FieldSet::copy() -> void
+{
+    // The retained fields are decoded by the const access, so the copy
+    // doesn't retain them
+    const FieldSet& source = *this;
+    auto* storage = createFields(*m_layout, [&source](std::size_t index, std::byte* address)
+        {
+            return source.at(index).cloneAt(address);
+        });
+
+    FieldSet detached;
+    detached.m_layout = m_layout;
+    detached.m_storage = storage;
+    swap(detached);
+}
+
+auto FieldSet::destroy() noexcept -> void
+{
+    if (!m_storage)
+        return;
+
+    if (references().fetch_sub(1U, std::memory_order_acq_rel) == 1U)
+    {
+        for (std::size_t index = 0U; index < m_layout->size(); ++index)
+            fields()[index]->~Field();
+
+        freeStorage(*m_layout, m_storage);
+    }
+
+    m_storage = nullptr;
+    m_layout.reset();
+    dropRetained();
 }
 
 auto FieldSet::serialize(SerializationContext& context) const -> void
 {
-    for (const auto& field : m_fields)
-        field->serialize(context);
+    if (m_retained and m_retained->reusableBy(context) and !m_retained->modified())
+    {
+        const auto bytes = m_retained->fields();
+        context.stream<BinaryWriter>().write(bytes.data(), bytes.size());
+        return;
+    }
+
+    // Fields decoded on access are written one by one
+    if (!m_retained and usesFixedLayout(m_layout, context))
+    {
+        serializeFixed(*m_layout, m_storage, context.stream<BinaryWriter>());
+        return;
+    }
+
+    for (std::size_t index = 0U; index < size(); ++index)
+        serializeField(context, index);
 }
 
 auto FieldSet::deserialize(SerializationContext& context) -> void
 {
-    for (auto& field : m_fields)
-        field->deserialize(context);
+    detach();
+    dropRetained();
+
+    if (usesFixedLayout(m_layout, context))
+    {
+        deserializeFixed(*m_layout, m_storage, context.stream<BinaryReader>());
+        return;
+    }
+
+    for (std::size_t index = 0U; index < size(); ++index)
+        fields()[index]->deserialize(context);
 }
 
-auto FieldSet::serializedSize() const noexcept -> std::size_t
+auto FieldSet::serializedSize() const -> std::size_t
 {
+    if (m_layout and m_layout->fixed())
+        return m_layout->fixedSize();
+
     std::size_t size = 0;
-    for (const auto& field : m_fields)
-        size += field->serializedSize();
+    for (std::size_t index = 0U; index < this->size(); ++index)
+        size += fieldSize(index);
+    return size;
+}
+
+auto FieldSet::serializeIndexed(SerializationContext& context) const -> void
+{
+    auto& writer = context.stream<BinaryWriter>();
+    if (m_retained and m_retained->reusableBy(context) and !m_retained->modified())
+    {
+        const auto frame = m_retained->frame;
+        writer.write(frame.data(), frame.size());
+        return;
+    }
+
+    // The table is reserved and filled in as the fields are written
+    const auto table_position = writer.size();
+    FieldOffset offset {};
+    for (std::size_t index = 0U; index < size(); ++index)
+        writer.write(&offset, sizeof offset);
+
+    const auto fields_position = writer.size();
+    for (std::size_t index = 0U; index < size(); ++index)
+    {
+        serializeField(context, index);
+
+        const auto end = writer.size() - fields_position;
+        if (end > std::numeric_limits<FieldOffset>::max())
+            throw IOException("Fields are too large for the offset table");
+
+        offset = static_cast<FieldOffset>(end);
+        if constexpr (std::endian::native == std::endian::big)
+            ByteUtils::swap(offset);
+        writer.overwrite(table_position + index * sizeof offset, &offset, sizeof offset);
+    }
+}
+
+auto FieldSet::deserializeIndexed(SerializationContext& context) -> void
+{
+    if (context.dictionary())
+        throw InvalidArgumentException("Fields decoded on access can't use a string dictionary");
+
+    auto& reader = context.stream<BinaryReader>();
+    const auto table = reader.take(size() * sizeof(FieldOffset));
+
+    FieldOffset end {};
+    for (std::size_t index = 0U; index < size(); ++index)
+    {
+        const auto offset = loadOffset(table.data(), index);
+        if (offset < end)
+            throw IOException("Invalid field offset table");
+        end = offset;
+    }
+
+    // The fields follow the table in the buffer
+    const auto fields = reader.take(end);
+    const std::string_view frame { table.data(), table.size() + fields.size() };
+
+    reset();
+    m_retained = Retained::create(context.binding(), size(), frame, reader.backing());
+}
+
+auto FieldSet::indexedSerializedSize() const -> std::size_t
+{
+    return size() * sizeof(FieldOffset) + serializedSize();
+}
+
+auto FieldSet::serializeSparse(SerializationContext& context) const -> void
+{
+    auto& writer = context.stream<BinaryWriter>();
+    const auto bitmap_position = writer.size();
+
+    BitmapWriter bitmap { writer };
+    for (std::size_t index = 0U; index < size(); ++index)
+        bitmap.push(!at(index).isDefault());
+    bitmap.finish();
+
+    serializeMarked(context, bitmap_position);
+}
+
+auto FieldSet::deserializeSparse(SerializationContext& context) -> void
+{
+    const auto bitmap = readBitmap(context);
+    detach();
+    dropRetained();
+
+    for (std::size_t index = 0U; index < size(); ++index)
+    {
+        if (bitIsSet(bitmap.data(), index))
+            fields()[index]->deserialize(context);
+        else
+            fields()[index]->reset();
+    }
+}
+
+auto FieldSet::sparseSerializedSize() const -> std::size_t
+{
+    std::size_t size = bitmapSize(this->size());
+    for (std::size_t index = 0U; index < this->size(); ++index)
+    {
+        if (!at(index).isDefault())
+            size += fieldSize(index);
+    }
     return size;
 }
 
+auto FieldSet::serializeDelta(SerializationContext& context, const FieldSet& base) const -> void
+{
+    if (base.size() != size())
+        throw InvalidArgumentException("Base field set doesn't match");
+
+    auto& writer = context.stream<BinaryWriter>();
+    const auto bitmap_position = writer.size();
+
+    BitmapWriter bitmap { writer };
+    for (std::size_t index = 0U; index < size(); ++index)
+        bitmap.push(!at(index).equals(base.at(index)));
+    bitmap.finish();
+
+    serializeMarked(context, bitmap_position);
+}
+
+auto FieldSet::deserializeDelta(SerializationContext& context) -> void
+{
+    const auto bitmap = readBitmap(context);
+    detach();
+
+    // The unchanged fields are kept
+    if (m_retained)
+        decodeRetained();
+
+    for (std::size_t index = 0U; index < size(); ++index)
+    {
+        if (bitIsSet(bitmap.data(), index))
+            fields()[index]->deserialize(context);
+    }
+}
+
+auto FieldSet::deltaSerializedSize(const FieldSet& base) const -> std::size_t
+{
+    std::size_t size = bitmapSize(this->size());
+    for (std::size_t index = 0U; index < this->size(); ++index)
+    {
+        if (index >= base.size() or !at(index).equals(base.at(index)))
+            size += fieldSize(index);
+    }
+    return size;
+}
+
+auto FieldSet::serializeMarked(SerializationContext& context, std::size_t bitmap_position) const -> void
+{
+    // The bitmap is read back from the writer, since it may be reallocated
+    // while the fields are written
+    const auto& writer = context.stream<BinaryWriter>();
+
+    for (std::size_t index = 0U; index < size(); ++index)
+    {
+        if (bitIsSet(writer.data() + bitmap_position, index))
+            serializeField(context, index);
+    }
+}
+
+auto FieldSet::serializeField(SerializationContext& context, std::size_t index) const -> void
+{
+    if (m_retained and m_retained->state(index).load(std::memory_order_relaxed) != Retained::Modified
+                   and m_retained->reusableBy(context))
+    {
+        const auto bytes = m_retained->bytes(index);
+        context.stream<BinaryWriter>().write(bytes.data(), bytes.size());
+        return;
+    }
+
+    at(index).serialize(context);
+}
+
+auto FieldSet::fieldSize(std::size_t index) const -> std::size_t
+{
+    // The bytes of the binary serializer are of the binary size of the value
+    if (m_retained and m_retained->state(index).load(std::memory_order_relaxed) != Retained::Modified
+                   and m_retained->binding.uses<BinarySerializer>())
+        return m_retained->bytes(index).size();
+
+    return at(index).serializedSize();
+}
+
+auto FieldSet::decode(std::size_t index) const -> void
+{
+    auto& state = m_retained->state(index);
+    auto current = state.load(std::memory_order_acquire);
+    while (current < Retained::Decoded)
+    {
+        // Another reader is decoding the field
+        if (current == Retained::Decoding)
+        {
+            state.wait(current, std::memory_order_acquire);
+            current = state.load(std::memory_order_acquire);
+            continue;
+        }
+
+        if (!state.compare_exchange_weak(current, Retained::Decoding, std::memory_order_acquire))
+            continue;
+
+        auto& field = *fields()[index];
+        try
+        {
+            BinaryReader reader { m_retained->bytes(index), m_retained->buffer };
+            auto context = m_retained->binding.bind(reader);
+            field.deserialize(context);
+
+            if (reader.remaining())
+                throw IOException("Field doesn't match the offset table");
+        }
+        catch (...)
+        {
+            field.reset();
+            state.store(Retained::Pending, std::memory_order_release);
+            state.notify_all();
+            throw;
+        }
+
+        state.store(Retained::Decoded, std::memory_order_release);
+        state.notify_all();
+        return;
+    }
+}
+
+auto FieldSet::modify(std::size_t index) -> void
+{
+    decode(index);
+    m_retained->state(index).store(Retained::Modified, std::memory_order_relaxed);
+}
+
+auto FieldSet::decodeRetained() -> void
+{
+    for (std::size_t index = 0U; index < size(); ++index)
+        decode(index);
+
+    dropRetained();
+}
+
+auto FieldSet::dropRetained() noexcept -> void
+{
+    Retained::release(std::exchange(m_retained, nullptr));
+}
+
+auto FieldSet::readBitmap(SerializationContext& context) const -> std::string_view
+{
+    const auto bitmap = context.stream<BinaryReader>().take(bitmapSize(size()));
+
+    // Bits beyond the last field mean the peer has another descriptor
+    if (size() % 8U != 0U and (static_cast<unsigned char>(bitmap.back()) >> (size() % 8U)) != 0U)
+        throw IOException("Invalid field bitmap");
+
+    return bitmap;
+}
+
 } // namespace isml
@@ -9,7 +9,9 @@
 #include <utility>
 #include <atomic>
 
+#include <isml/io/format.hpp>
 #include <isml/message/message_descriptor.hpp>
+#include <isml/message/message_pool.hpp>
 #include <isml/session/session.hpp>
 
 namespace isml {
@@ -23,18 +25,17 @@ static auto generateId() -> MessageId
 Message::Message(const MessageDescriptor& descriptor, Session::Ptr session)
     : m_id(generateId())
     , m_type(descriptor.type())
-    , m_fieldset()
+    , m_fieldset(descriptor.layout())
     , m_session(std::move(session))
-{
-    for (const auto& field_descriptor : descriptor.fieldDescriptors())
-        m_fieldset.add(field_descriptor->createField());
-}
+{}
 
 Message::Message(const Message& other)
     : m_id(generateId())
     , m_type(other.m_type)
     , m_fieldset(other.m_fieldset)
     , m_session(other.m_session)
+    , m_stream_id(other.m_stream_id)
+    , m_timestamps(other.m_timestamps)
 {}
 
 Message::Message(Message&& other) noexcept
@@ -42,6 +43,8 @@ Message::Message(Message&& other) noexcept
     , m_type(other.m_type)
     , m_fieldset(std::move(other.m_fieldset))
     , m_session(std::move(other.m_session))
+    , m_stream_id(other.m_stream_id)
+    , m_timestamps(other.m_timestamps)
 {}
 
 auto Message::type() const noexcept -> MessageType
@@ -64,9 +67,36 @@ auto Message::hasField(const std::string& name) const noexcept -> bool
     return m_fieldset.contains(name);
 }
 
-auto Message::clone() const noexcept -> Message::Ptr
+auto Message::streamId() const noexcept -> StreamId
+{
+    return m_stream_id;
+}
+
+auto Message::setStreamId(StreamId stream_id) noexcept -> void
+{
+    m_stream_id = stream_id;
+}
+
+auto Message::timestamps() const noexcept -> const MessageTimestamps&
+{
+    return m_timestamps;
+}
+
+auto Message::setTimestamps(const MessageTimestamps& timestamps) noexcept -> void
+{
+    m_timestamps = timestamps;
+}
+
+auto Message::clone() const -> Message::Ptr
 {
-    return std::make_unique<Message>(*this);
+    Message::Ptr copy { new Message(*this) };
+    copy->own();
+    return copy;
+}
+
+auto Message::own() -> void
+{
+    m_fieldset.own();
 }
 
 auto Message::serialize(SerializationContext& context) const -> void
@@ -79,14 +109,92 @@ auto Message::deserialize(SerializationContext& context) -> void
     return m_fieldset.deserialize(context);
 }
 
-auto Message::serializedSize() const noexcept -> std::size_t
+auto Message::serializedSize() const -> std::size_t
 {
     return m_fieldset.serializedSize();
 }
 
+auto Message::serializeIndexed(SerializationContext& context) const -> void
+{
+    m_fieldset.serializeIndexed(context);
+}
+
+auto Message::deserializeIndexed(SerializationContext& context) -> void
+{
+    m_fieldset.deserializeIndexed(context);
+}
+
+auto Message::indexedSerializedSize() const -> std::size_t
+{
+    return m_fieldset.indexedSerializedSize();
+}
+
+auto Message::serializeSparse(SerializationContext& context) const -> void
+{
+    m_fieldset.serializeSparse(context);
+}
+
+auto Message::deserializeSparse(SerializationContext& context) -> void
+{
+    m_fieldset.deserializeSparse(context);
+}
+
+auto Message::sparseSerializedSize() const -> std::size_t
+{
+    return m_fieldset.sparseSerializedSize();
+}
+
+auto Message::serializeDelta(SerializationContext& context, const Message& base) const -> void
+{
+    m_fieldset.serializeDelta(context, base.m_fieldset);
+}
+
+auto Message::deserializeDelta(SerializationContext& context) -> void
+{
+    m_fieldset.deserializeDelta(context);
+}
+
+auto Message::deltaSerializedSize(const Message& base) const -> std::size_t
+{
+    return m_fieldset.deltaSerializedSize(base.m_fieldset);
+}
+
 auto Message::sessionId() const noexcept -> SessionId
 {
     return m_session ? m_session->id() : kBadSessionId;
 }
 
+auto Message::recycle() -> void
+{
+    m_fieldset.reset();
+    m_session.reset();
+    m_stream_id = {};
+    m_timestamps = {};
+}
+
+auto Message::renew(std::shared_ptr<Session> session) noexcept -> void
+{
+    m_id = generateId();
+    m_session = std::move(session);
+}
+
+auto MessageDeleter::operator()(Message* message) const noexcept -> void
+{
+    if (message->m_pool)
+        message->m_pool->release(message);
+    else
+        delete message;
+}
+
+auto Message::checkHandle(MessageType message_type, std::size_t index, const std::type_info& value_type) const -> void
+{
+    // The handle of an earlier layout of the type refers to the same field,
+    // registering a field keeps the indices of the existing ones
+    if (message_type == m_type and index < m_fieldset.size() and m_fieldset.at(index).valueType() == value_type)
+        return;
+
+    throw FieldDoesNotExistException(fmt::format("Field handle of message type {} doesn't refer to a field of the message", message_type),
+                                     fmt::format("#{}", index), sessionId(), m_id);
+}
+
 } // namespace isml
@@ -5,16 +5,16 @@
  */
 
 #include <isml/message/message_descriptor.hpp>
-#include <isml/exceptions.hpp>
-#include <isml/io/format.hpp>
+
+#include <memory>
+#include <utility>
 
 namespace isml {
 
 MessageDescriptor::MessageDescriptor(const MessageDescriptor& other)
     : m_type(other.m_type)
-{
-    copy(other);
-}
+    , m_layout(other.m_layout)
+{}
 
 MessageDescriptor::MessageDescriptor(MessageDescriptor&& other) noexcept
     : m_type(other.m_type)
@@ -24,6 +24,7 @@ MessageDescriptor::MessageDescriptor(MessageDescriptor&& other) noexcept
 
 MessageDescriptor::MessageDescriptor(MessageType type) noexcept
     : m_type(type)
+    , m_layout(std::make_shared<const FieldLayout>())
 {}
 
 auto MessageDescriptor::operator=(const MessageDescriptor& other) -> MessageDescriptor&
@@ -59,40 +60,39 @@ auto MessageDescriptor::registerField(FieldDescriptor::Ptr descriptor) -> Messag
 
 auto MessageDescriptor::addFieldDescriptor(FieldDescriptor::Ptr descriptor) -> void
 {
-    if (m_field_descriptors_by_name.contains(descriptor->name()))
-        throw InvalidArgumentException(fmt::format("Descriptor with same name ({}) has already been registered", descriptor->name()));
-
-    const auto& name = descriptor->name();
-    auto it = m_field_descriptors.empty() ? m_field_descriptors.begin() : std::prev(m_field_descriptors.end());
-    it = m_field_descriptors.insert(it, std::move(descriptor));
-    m_field_descriptors_by_name.insert(std::make_pair(name, it));
+    // Messages created before keep the previous layout
+    m_layout = m_layout->extend(std::move(descriptor));
 }
 
 auto MessageDescriptor::fieldDescriptors() const noexcept -> const FieldDescriptors&
 {
-    return m_field_descriptors;
+    return m_layout->descriptors();
+}
+
+auto MessageDescriptor::layout() const noexcept -> const FieldLayout::Ptr&
+{
+    return m_layout;
+}
+
+auto MessageDescriptor::fixedSerializedSize() const noexcept -> Maybe<std::size_t>
+{
+    Maybe<std::size_t> size { none };
+    if (m_layout->fixed())
+        size = m_layout->fixedSize();
+    return size;
 }
 
 auto MessageDescriptor::swap(MessageDescriptor& other) noexcept -> void
 {
     std::swap(m_type, other.m_type);
-    std::swap(m_field_descriptors, other.m_field_descriptors);
-    std::swap(m_field_descriptors_by_name, other.m_field_descriptors_by_name);
+    std::swap(m_layout, other.m_layout);
 }
 
 auto MessageDescriptor::copy(const MessageDescriptor& other) -> void
 {
+    // The layout is immutable, so it is shared rather than copied
     m_type = other.m_type;
-
-    m_field_descriptors.clear();
-    m_field_descriptors_by_name.clear();
-
-    auto it = m_field_descriptors.begin();
-    for (const auto& descriptor : other.m_field_descriptors)
-    {
-        it = m_field_descriptors.insert(it, descriptor->clone());
-        m_field_descriptors_by_name.insert(std::make_pair(descriptor->name(), it));
-    }
+    m_layout = other.m_layout;
 }
 
 } // namespace isml
@@ -6,8 +6,10 @@
 
 #include <isml/message/message_factory.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include <isml/message/exceptions.hpp>
 
@@ -16,8 +18,9 @@
 namespace isml {
 
 MessageFactory::MessageFactory(const MessageFactory& other)
-    : m_descriptors(other.m_descriptors)
-{}
+{
+    *this = other;
+}
 
 MessageFactory::MessageFactory(MessageFactory&& other) noexcept
 {
@@ -28,7 +31,16 @@ auto MessageFactory::operator=(const MessageFactory& other) -> MessageFactory&
 {
     if (this != &other)
     {
+        std::scoped_lock lock { m_mutex, other.m_mutex };
         m_descriptors = other.m_descriptors;
+        m_pool_capacity = other.m_pool_capacity;
+        m_pools.clear();
+        createPools();
+
+        // The published table refers to the replaced descriptors
+        m_table.store(nullptr, std::memory_order_release);
+        if (other.frozen())
+            publish();
     }
 
     return *this;
@@ -52,29 +64,198 @@ auto MessageFactory::getInstance() -> MessageFactory&
 
 auto MessageFactory::createMessage(MessageType type, Session& session) -> Message::Ptr
 {
-    if (!m_descriptors.contains(type))
+    auto message = tryCreateMessage(type, session);
+    if (!message)
         throw UnknownMessageTypeException("There is no registered descriptor for this message type", type);
 
-    const auto& descriptor = m_descriptors.at(type);
-    return std::make_unique<Message>(descriptor, session.shared_from_this());
+    return message;
+}
+
+auto MessageFactory::tryCreateMessage(MessageType type, Session& session) -> Message::Ptr
+{
+    if (const auto table = m_table.load(std::memory_order_acquire))
+    {
+        if (type >= table->size())
+            return {};
+
+        const auto& entry = (*table)[type];
+        if (entry.pool)
+            return entry.pool->acquire(session.shared_from_this());
+
+        if (!entry.descriptor)
+            return {};
+
+        return Message::Ptr { new Message(*entry.descriptor, session.shared_from_this()) };
+    }
+
+    if (!m_pools.empty())
+    {
+        if (const auto it = m_pools.find(type); it != m_pools.end())
+            return it->second->acquire(session.shared_from_this());
+    }
+
+    const auto it = m_descriptors.find(type);
+    if (it == m_descriptors.end())
+        return {};
+
+    return Message::Ptr { new Message(it->second, session.shared_from_this()) };
 }
 
-auto MessageFactory::addDescriptor(MessageDescriptor descriptor) noexcept -> bool
+auto MessageFactory::addDescriptor(MessageDescriptor descriptor) -> bool
 {
+    std::lock_guard lock { m_mutex };
+
     const auto type = descriptor.type();
-    const auto [_, inserted] =
+    if (type == k_reserved_msg_type)
+        return false;
+
+    const auto [it, inserted] =
         m_descriptors.insert(std::make_pair(type, std::move(descriptor)));
+
+    if (inserted and m_pool_capacity)
+        m_pools.insert_or_assign(type, std::make_shared<MessagePool>(it->second, m_pool_capacity));
+
+    if (inserted and frozen())
+        publish();
+
     return inserted;
 }
 
 auto MessageFactory::hasDescriptor(MessageType type) const noexcept -> bool
 {
-    return m_descriptors.contains(type);
+    return findDescriptor(type) != nullptr;
+}
+
+auto MessageFactory::setPoolCapacity(std::size_t capacity) -> void
+{
+    std::lock_guard lock { m_mutex };
+
+    m_pool_capacity = capacity;
+    createPools();
+
+    if (frozen())
+        publish();
+}
+
+auto MessageFactory::pool(MessageType type) const noexcept -> Maybe<MessagePool&>
+{
+    Maybe<MessagePool&> pool { none };
+    if (const auto table = m_table.load(std::memory_order_acquire))
+    {
+        if (type < table->size() and (*table)[type].pool)
+            pool = *(*table)[type].pool;
+    }
+    else if (const auto it = m_pools.find(type); it != m_pools.end())
+    {
+        pool = *it->second;
+    }
+
+    return pool;
+}
+
+auto MessageFactory::freeze() -> void
+{
+    std::lock_guard lock { m_mutex };
+    publish();
+}
+
+auto MessageFactory::frozen() const noexcept -> bool
+{
+    return m_table.load(std::memory_order_acquire) != nullptr;
+}
+
+auto MessageFactory::fingerprint() const -> std::uint64_t
+{
+    std::lock_guard lock { m_mutex };
+
+    // FNV-1a
+    std::uint64_t hash = 0xCBF29CE484222325ULL;
+    auto update = [&hash](const void* data, std::size_t size)
+        {
+            const auto* bytes = static_cast<const unsigned char*>(data);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                hash ^= bytes[i];
+                hash *= 0x100000001B3ULL;
+            }
+        };
+
+    std::vector<MessageType> types;
+    types.reserve(m_descriptors.size());
+    for (const auto& [type, _] : m_descriptors)
+        types.push_back(type);
+
+    std::sort(types.begin(), types.end());
+
+    for (const auto type : types)
+    {
+        // Little-endian, so that peers of any byte order agree
+        const unsigned char type_bytes[] { static_cast<unsigned char>(type & 0xFFU), static_cast<unsigned char>(type >> 8U) };
+        update(type_bytes, sizeof type_bytes);
+
+        for (const auto& field : m_descriptors.at(type).fieldDescriptors())
+        {
+            const auto signature = field->valueSignature();
+            update(field->name().c_str(), field->name().size() + 1U);
+            update(signature.c_str(), signature.size() + 1U);
+        }
+    }
+
+    return hash;
 }
 
 auto MessageFactory::swap(MessageFactory& other) noexcept -> void
 {
     std::swap(m_descriptors, other.m_descriptors);
+    std::swap(m_pools, other.m_pools);
+    std::swap(m_pool_capacity, other.m_pool_capacity);
+
+    // The tables refer to the map nodes, which are swapped along with them
+    auto table = m_table.load(std::memory_order_relaxed);
+    m_table.store(other.m_table.exchange(std::move(table), std::memory_order_acq_rel), std::memory_order_release);
+}
+
+auto MessageFactory::findDescriptor(MessageType type) const noexcept -> const MessageDescriptor*
+{
+    if (const auto table = m_table.load(std::memory_order_acquire))
+        return type < table->size() ? (*table)[type].descriptor : nullptr;
+
+    const auto it = m_descriptors.find(type);
+    return it != m_descriptors.end() ? &it->second : nullptr;
+}
+
+auto MessageFactory::createPools() -> void
+{
+    if (!m_pool_capacity)
+    {
+        m_pools.clear();
+        return;
+    }
+
+    // The pools which are kept keep their idle messages as well
+    for (const auto& [type, descriptor] : m_descriptors)
+    {
+        auto& pool = m_pools[type];
+        if (!pool or pool->capacity() != m_pool_capacity)
+            pool = std::make_shared<MessagePool>(descriptor, m_pool_capacity);
+    }
+}
+
+auto MessageFactory::publish() -> void
+{
+    std::size_t size = 0U;
+    for (const auto& [type, _] : m_descriptors)
+        size = std::max<std::size_t>(size, type + 1U);
+
+    auto table = std::make_shared<Table>(size);
+    for (const auto& [type, descriptor] : m_descriptors)
+        (*table)[type].descriptor = &descriptor;
+
+    for (const auto& [type, pool] : m_pools)
+        (*table)[type].pool = pool;
+
+    // Readers still holding the previous table free it when they are done
+    m_table.store(std::move(table), std::memory_order_release);
 }
 
 } // namespace isml
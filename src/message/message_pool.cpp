@@ -0,0 +1,135 @@
+/**
+ * @file    message_pool.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#include <isml/message/message_pool.hpp>
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <isml/session/session.hpp>
+
+namespace isml {
+
+namespace {
+
+/**
+ * Idle messages of the current thread by pool. An entry of a pool can't
+ * outlive the pool while it isn't empty, since the messages hold the pool.
+ */
+
+class FreeLists
+{
+public:
+    FreeLists() = default;
+
+    ~FreeLists()
+    {
+        s_destroyed = true;
+
+        for (auto& [_, messages] : m_lists)
+        {
+            for (auto* message : messages)
+                delete message;
+        }
+    }
+
+    auto get(const MessagePool* pool) -> std::vector<Message*>&
+    {
+        return m_lists[pool];
+    }
+
+    /// Set when the lists of the thread have been destroyed.
+    static thread_local bool s_destroyed;
+
+private:
+    std::unordered_map<const MessagePool*, std::vector<Message*>> m_lists {};
+};
+
+thread_local bool FreeLists::s_destroyed = false;
+
+auto freeLists() -> FreeLists&
+{
+    static thread_local FreeLists lists;
+    return lists;
+}
+
+} // namespace
+
+MessagePool::MessagePool(MessageDescriptor descriptor, std::size_t capacity)
+    : m_descriptor(std::move(descriptor))
+    , m_capacity(capacity)
+{}
+
+auto MessagePool::acquire(std::shared_ptr<Session> session) -> Message::Ptr
+{
+    if (!FreeLists::s_destroyed)
+    {
+        auto& messages = freeLists().get(this);
+        if (!messages.empty())
+        {
+            Message::Ptr message { messages.back() };
+            messages.pop_back();
+            m_statistics.hits.fetch_add(1U, std::memory_order_relaxed);
+
+            message->renew(std::move(session));
+            return message;
+        }
+    }
+
+    m_statistics.misses.fetch_add(1U, std::memory_order_relaxed);
+
+    Message::Ptr message { new Message(m_descriptor, std::move(session)) };
+    message->m_pool = shared_from_this();
+    return message;
+}
+
+auto MessagePool::release(Message* message) noexcept -> void
+{
+    try
+    {
+        if (!FreeLists::s_destroyed)
+        {
+            auto& messages = freeLists().get(this);
+            if (messages.size() < m_capacity)
+            {
+                message->recycle();
+                messages.push_back(message);
+                return;
+            }
+        }
+    }
+    catch (...)
+    {
+        // The message is freed below
+    }
+
+    m_statistics.discarded.fetch_add(1U, std::memory_order_relaxed);
+    delete message;
+}
+
+auto MessagePool::trim() noexcept -> void
+{
+    if (FreeLists::s_destroyed)
+        return;
+
+    auto& messages = freeLists().get(this);
+    auto idle = std::move(messages);
+    for (auto* message : idle)
+        delete message;
+}
+
+auto MessagePool::capacity() const noexcept -> std::size_t
+{
+    return m_capacity;
+}
+
+auto MessagePool::statistics() const noexcept -> const MessagePoolStatistics&
+{
+    return m_statistics;
+}
+
+} // namespace isml
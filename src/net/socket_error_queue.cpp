@@ -0,0 +1,84 @@
+/**
+ * @file    socket_error_queue.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#include <isml/net/socket_error_queue.hpp>
+
+#include <cerrno>
+#include <cstring>
+
+#if defined(__linux__)
+#   include <sys/socket.h>
+#   include <netinet/in.h>
+#   include <linux/errqueue.h>
+#endif
+
+namespace isml {
+
+#if defined(__linux__)
+
+auto SocketErrorQueue::read(NativeHandle fd) -> SocketNotifications
+{
+    SocketNotifications notifications;
+
+    for (;;)
+    {
+        alignas(cmsghdr) char control[256];
+
+        msghdr msg {};
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+
+        if (::recvmsg(fd, &msg, MSG_ERRQUEUE | MSG_DONTWAIT) < 0)
+            break;
+
+        TransmitTimestamp transmitted;
+        bool has_timestamp = false;
+
+        for (auto* cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg))
+        {
+            if (SocketTimestamping::parse(cmsg, transmitted.timestamp))
+            {
+                has_timestamp = true;
+                continue;
+            }
+
+            const auto is_error = (cmsg->cmsg_level == SOL_IP and cmsg->cmsg_type == IP_RECVERR)
+                               or (cmsg->cmsg_level == SOL_IPV6 and cmsg->cmsg_type == IPV6_RECVERR);
+            if (!is_error)
+                continue;
+
+            sock_extended_err err {};
+            std::memcpy(&err, CMSG_DATA(cmsg), sizeof(err));
+
+            if (err.ee_origin == SO_EE_ORIGIN_ZEROCOPY and err.ee_errno == 0)
+            {
+                notifications.zero_copy.push_back(
+                    { err.ee_info, err.ee_data, (err.ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0 });
+            }
+            else if (err.ee_origin == SO_EE_ORIGIN_TIMESTAMPING and err.ee_errno == ENOMSG)
+            {
+                transmitted.key = err.ee_data;
+            }
+        }
+
+        // The timestamp comes before the error description in the same message
+        if (has_timestamp)
+            notifications.transmitted.push_back(transmitted);
+    }
+
+    return notifications;
+}
+
+#else
+
+auto SocketErrorQueue::read(NativeHandle) -> SocketNotifications
+{
+    return {};
+}
+
+#endif
+
+} // namespace isml
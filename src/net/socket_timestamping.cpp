@@ -0,0 +1,110 @@
+/**
+ * @file    socket_timestamping.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#include <isml/net/socket_timestamping.hpp>
+
+#include <cerrno>
+#include <cstring>
+
+#if defined(__linux__)
+#   include <sys/socket.h>
+#   include <linux/errqueue.h>
+#   include <linux/net_tstamp.h>
+#endif
+
+namespace isml {
+
+#if defined(__linux__)
+
+namespace {
+
+auto toNanoseconds(const timespec& ts) noexcept -> std::chrono::nanoseconds
+{
+    return std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec);
+}
+
+constexpr std::size_t k_control_size = 256U;
+
+} // namespace
+
+auto SocketTimestamping::enable(NativeHandle fd, Source source) noexcept -> std::error_code
+{
+    unsigned flags = SOF_TIMESTAMPING_RX_SOFTWARE
+                   | SOF_TIMESTAMPING_TX_SOFTWARE
+                   | SOF_TIMESTAMPING_SOFTWARE
+                   | SOF_TIMESTAMPING_OPT_ID
+                   | SOF_TIMESTAMPING_OPT_TSONLY;
+
+    if (source == Source::Hardware)
+    {
+        flags |= SOF_TIMESTAMPING_RX_HARDWARE
+              |  SOF_TIMESTAMPING_TX_HARDWARE
+              |  SOF_TIMESTAMPING_RAW_HARDWARE;
+    }
+
+    if (::setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags)) != 0)
+        return { errno, std::system_category() };
+
+    return {};
+}
+
+auto SocketTimestamping::receive(NativeHandle fd, void* data, std::size_t size, SocketTimestamp& timestamp) noexcept
+    -> Result<std::size_t, std::error_code>
+{
+    iovec iov { data, size };
+    alignas(cmsghdr) char control[k_control_size];
+
+    msghdr msg {};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    const auto received = ::recvmsg(fd, &msg, MSG_DONTWAIT);
+    if (received < 0)
+        return Failure { std::error_code(errno, std::system_category()) };
+
+    for (auto* cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg))
+        parse(cmsg, timestamp);
+
+    return Success { static_cast<std::size_t>(received) };
+}
+
+auto SocketTimestamping::parse(const cmsghdr* cmsg, SocketTimestamp& timestamp) noexcept -> bool
+{
+    if (cmsg->cmsg_level != SOL_SOCKET or cmsg->cmsg_type != SCM_TIMESTAMPING)
+        return false;
+
+    scm_timestamping ts {};
+    std::memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+
+    // ts[1] is deprecated, ts[2] is the raw hardware time
+    timestamp.software = toNanoseconds(ts.ts[0]);
+    timestamp.hardware = toNanoseconds(ts.ts[2]);
+    return true;
+}
+
+#else
+
+auto SocketTimestamping::enable(NativeHandle, Source) noexcept -> std::error_code
+{
+    return std::make_error_code(std::errc::operation_not_supported);
+}
+
+auto SocketTimestamping::receive(NativeHandle, void*, std::size_t, SocketTimestamp&) noexcept
+    -> Result<std::size_t, std::error_code>
+{
+    return Failure { std::make_error_code(std::errc::operation_not_supported) };
+}
+
+auto SocketTimestamping::parse(const cmsghdr*, SocketTimestamp&) noexcept -> bool
+{
+    return false;
+}
+
+#endif
+
+} // namespace isml
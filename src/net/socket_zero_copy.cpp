@@ -0,0 +1,53 @@
+/**
+ * @file    socket_zero_copy.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#include <isml/net/socket_zero_copy.hpp>
+
+#include <cerrno>
+
+#if defined(__linux__)
+#   include <sys/socket.h>
+#endif
+
+namespace isml {
+
+#if defined(__linux__) && defined(MSG_ZEROCOPY)
+
+auto SocketZeroCopy::enable(NativeHandle fd) noexcept -> std::error_code
+{
+    const int on = 1;
+    if (::setsockopt(fd, SOL_SOCKET, SO_ZEROCOPY, &on, sizeof(on)) != 0)
+        return { errno, std::system_category() };
+
+    return {};
+}
+
+auto SocketZeroCopy::send(NativeHandle fd, const void* data, std::size_t size) noexcept
+    -> Result<std::size_t, std::error_code>
+{
+    const auto sent = ::send(fd, data, size, MSG_ZEROCOPY | MSG_DONTWAIT | MSG_NOSIGNAL);
+    if (sent < 0)
+        return Failure { std::error_code(errno, std::system_category()) };
+
+    return Success { static_cast<std::size_t>(sent) };
+}
+
+#else
+
+auto SocketZeroCopy::enable(NativeHandle) noexcept -> std::error_code
+{
+    return std::make_error_code(std::errc::operation_not_supported);
+}
+
+auto SocketZeroCopy::send(NativeHandle, const void*, std::size_t) noexcept
+    -> Result<std::size_t, std::error_code>
+{
+    return Failure { std::make_error_code(std::errc::operation_not_supported) };
+}
+
+#endif
+
+} // namespace isml
@@ -61,6 +61,19 @@ auto Url::path() const noexcept -> const std::string&
     return m_path;
 }
 
+auto Url::parameter(const std::string& name) const -> Maybe<std::string>
+{
+    if (auto it = m_parameters.find(name); it != m_parameters.cend())
+        return it->second;
+
+    return none;
+}
+
+auto Url::parameters() const noexcept -> const Parameters&
+{
+    return m_parameters;
+}
+
 auto Url::toString() const noexcept -> std::string
 {
     auto str = fmt::format("{}://{}", m_protocol, m_hostname);
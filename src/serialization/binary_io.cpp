@@ -0,0 +1,85 @@
+/**
+ * @file    binary_io.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#include <isml/serialization/binary_io.hpp>
+
+#include <algorithm>
+
+#include <isml/exceptions.hpp>
+
+namespace isml {
+
+namespace {
+
+constexpr std::size_t k_min_capacity = 64U;
+
+} // namespace
+
+BinaryWriter::BinaryWriter(std::span<char> buffer) noexcept
+    : m_data(buffer.data())
+    , m_capacity(buffer.size())
+    , m_external(true)
+{}
+
+auto BinaryWriter::grow(std::size_t required) -> void
+{
+    if (m_external)
+        throw IOException("Buffer overflow");
+
+    const auto capacity = std::max({ required, m_capacity * 2U, k_min_capacity });
+    auto storage = std::make_unique_for_overwrite<char[]>(capacity);
+    if (m_size)
+        std::memcpy(storage.get(), m_data, m_size);
+
+    m_storage = std::move(storage);
+    m_data = m_storage.get();
+    m_capacity = capacity;
+}
+
+auto BinaryWriter::throwOutOfRange() -> void
+{
+    throw IOException("Position is out of the written data");
+}
+
+BinaryReader::BinaryReader(std::span<const char> data) noexcept
+    : m_data(data.data())
+    , m_size(data.size())
+{}
+
+BinaryReader::BinaryReader(std::string_view data) noexcept
+    : m_data(data.data())
+    , m_size(data.size())
+{}
+
+BinaryReader::BinaryReader(const SharedBuffer& buffer) noexcept
+    : m_data(buffer.data())
+    , m_size(buffer.size())
+    , m_backing(&buffer)
+{}
+
+BinaryReader::BinaryReader(std::string_view data, const SharedBuffer& backing) noexcept
+    : m_data(data.data())
+    , m_size(data.size())
+    , m_backing(&backing)
+{}
+
+auto BinaryReader::takeShared(std::size_t size) -> std::pair<SharedBuffer, std::string_view>
+{
+    const auto bytes = take(size);
+    if (m_backing)
+        return { *m_backing, bytes };
+
+    auto buffer = SharedBuffer::copy(nullptr, bytes);
+    const auto view = buffer.view();
+    return { std::move(buffer), view };
+}
+
+auto BinaryReader::throwEndOfData() -> void
+{
+    throw IOException("Unexpected end of data");
+}
+
+} // namespace isml
@@ -0,0 +1,426 @@
+/**
+ * @file    json_io.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#include <isml/serialization/json_io.hpp>
+
+#include <cstdint>
+
+namespace isml {
+
+namespace {
+
+constexpr char k_hex_digits[] = "0123456789abcdef";
+
+auto needsEscape(char c) noexcept -> bool
+{
+    return static_cast<unsigned char>(c) < 0x20U or c == '"' or c == '\\';
+}
+
+auto hexValue(char c) -> std::uint32_t
+{
+    if (c >= '0' and c <= '9') return static_cast<std::uint32_t>(c - '0');
+    if (c >= 'a' and c <= 'f') return static_cast<std::uint32_t>(c - 'a' + 10);
+    if (c >= 'A' and c <= 'F') return static_cast<std::uint32_t>(c - 'A' + 10);
+    throw IOException("Invalid JSON escape sequence");
+}
+
+auto appendUtf8(std::string& text, std::uint32_t code_point) -> void
+{
+    if (code_point < 0x80U)
+    {
+        text.push_back(static_cast<char>(code_point));
+    }
+    else if (code_point < 0x800U)
+    {
+        text.push_back(static_cast<char>(0xC0U | (code_point >> 6U)));
+        text.push_back(static_cast<char>(0x80U | (code_point & 0x3FU)));
+    }
+    else if (code_point < 0x10000U)
+    {
+        text.push_back(static_cast<char>(0xE0U | (code_point >> 12U)));
+        text.push_back(static_cast<char>(0x80U | ((code_point >> 6U) & 0x3FU)));
+        text.push_back(static_cast<char>(0x80U | (code_point & 0x3FU)));
+    }
+    else
+    {
+        text.push_back(static_cast<char>(0xF0U | (code_point >> 18U)));
+        text.push_back(static_cast<char>(0x80U | ((code_point >> 12U) & 0x3FU)));
+        text.push_back(static_cast<char>(0x80U | ((code_point >> 6U) & 0x3FU)));
+        text.push_back(static_cast<char>(0x80U | (code_point & 0x3FU)));
+    }
+}
+
+} // namespace
+
+auto JsonWriter::beginObject() -> void
+{
+    put('{');
+    m_scopes.push_back({ true, true });
+}
+
+auto JsonWriter::endObject() -> void
+{
+    put('}');
+    m_scopes.pop_back();
+}
+
+auto JsonWriter::beginArray() -> void
+{
+    put('[');
+    m_scopes.push_back({ false, true });
+}
+
+auto JsonWriter::endArray() -> void
+{
+    put(']');
+    m_scopes.pop_back();
+}
+
+auto JsonWriter::writeNull() -> void
+{
+    put("null");
+}
+
+auto JsonWriter::writeBool(bool value) -> void
+{
+    put(value ? std::string_view { "true" } : std::string_view { "false" });
+}
+
+auto JsonWriter::writeString(std::string_view value) -> void
+{
+    put('"');
+
+    // Runs of characters not requiring an escape are copied at once
+    std::size_t begin = 0U;
+    for (std::size_t i = 0U; i < value.size(); ++i)
+    {
+        const auto c = value[i];
+        if (!needsEscape(c))
+            continue;
+
+        put(value.substr(begin, i - begin));
+        begin = i + 1U;
+
+        switch (c)
+        {
+            case '"':  put("\\\""); break;
+            case '\\': put("\\\\"); break;
+            case '\b': put("\\b"); break;
+            case '\f': put("\\f"); break;
+            case '\n': put("\\n"); break;
+            case '\r': put("\\r"); break;
+            case '\t': put("\\t"); break;
+            default:
+            {
+                const auto code = static_cast<unsigned char>(c);
+                const char escape[] = { '\\', 'u', '0', '0', k_hex_digits[code >> 4U], k_hex_digits[code & 0x0FU] };
+                put({ escape, sizeof escape });
+                break;
+            }
+        }
+    }
+
+    put(value.substr(begin));
+    put('"');
+}
+
+JsonReader::JsonReader(std::string_view json) noexcept
+    : m_data(json)
+{}
+
+auto JsonReader::member(std::string_view name) -> void
+{
+    if (m_scopes.empty() or !m_scopes.back().object)
+        return;
+
+    if (nextKey() and m_key == name)
+        return;
+
+    // Look the member up from the beginning of the object
+    auto& scope = m_scopes.back();
+    m_position = scope.start;
+    scope.first = true;
+    while (nextKey())
+    {
+        if (m_key == name)
+            return;
+        skipValue();
+    }
+
+    throw IOException("JSON member not found: " + std::string(name));
+}
+
+auto JsonReader::nextMember(std::string& name) -> bool
+{
+    if (m_scopes.empty() or !m_scopes.back().object)
+        throwMalformed();
+
+    if (!nextKey())
+        return false;
+
+    name = m_key;
+    return true;
+}
+
+auto JsonReader::nextKey() -> bool
+{
+    auto& scope = m_scopes.back();
+    auto c = peek();
+    if (c == '}')
+        return false;
+
+    if (!scope.first)
+    {
+        if (c != ',')
+            throwMalformed();
+        ++m_position;
+        c = peek();
+    }
+
+    if (c != '"')
+        throwMalformed();
+
+    readText(m_key);
+    expect(':');
+    scope.first = false;
+    return true;
+}
+
+auto JsonReader::beginObject() -> void
+{
+    expect('{');
+    m_scopes.push_back({ true, true, m_position });
+}
+
+auto JsonReader::endObject() -> void
+{
+    if (m_scopes.empty() or !m_scopes.back().object)
+        throwMalformed();
+
+    while (nextKey())
+        skipValue();
+
+    expect('}');
+    m_scopes.pop_back();
+}
+
+auto JsonReader::beginArray() -> void
+{
+    expect('[');
+    m_scopes.push_back({ false, true, m_position });
+}
+
+auto JsonReader::nextItem() -> bool
+{
+    if (m_scopes.empty() or m_scopes.back().object)
+        throwMalformed();
+
+    auto& scope = m_scopes.back();
+    if (peek() == ']')
+        return false;
+
+    if (!scope.first)
+        expect(',');
+    scope.first = false;
+    return true;
+}
+
+auto JsonReader::endArray() -> void
+{
+    if (m_scopes.empty() or m_scopes.back().object)
+        throwMalformed();
+
+    expect(']');
+    m_scopes.pop_back();
+}
+
+auto JsonReader::readNull() -> bool
+{
+    if (peek() != 'n')
+        return false;
+
+    literal("null");
+    return true;
+}
+
+auto JsonReader::readBool() -> bool
+{
+    if (peek() == 't')
+    {
+        literal("true");
+        return true;
+    }
+
+    literal("false");
+    return false;
+}
+
+auto JsonReader::readString(std::string& value) -> void
+{
+    if (peek() != '"')
+        throwMalformed();
+
+    readText(value);
+}
+
+auto JsonReader::skipValue() -> void
+{
+    switch (peek())
+    {
+        case '{':
+        {
+            beginObject();
+            endObject();
+            break;
+        }
+        case '[':
+        {
+            beginArray();
+            while (nextItem())
+                skipValue();
+            endArray();
+            break;
+        }
+        case '"':
+            skipText();
+            break;
+        case 't':
+            literal("true");
+            break;
+        case 'f':
+            literal("false");
+            break;
+        case 'n':
+            literal("null");
+            break;
+        default:
+            number();
+            break;
+    }
+}
+
+auto JsonReader::literal(std::string_view text) -> void
+{
+    skipSpace();
+    if (m_data.substr(m_position, text.size()) != text)
+        throwMalformed();
+    m_position += text.size();
+}
+
+auto JsonReader::readText(std::string& value) -> void
+{
+    // The cursor is at the opening quote
+    const auto begin = ++m_position;
+    auto end = begin;
+    while (end < m_data.size() and m_data[end] != '"' and m_data[end] != '\\')
+        ++end;
+
+    if (end == m_data.size())
+        throwMalformed();
+
+    value.assign(m_data.data() + begin, end - begin);
+    m_position = end;
+
+    while (m_data[m_position] != '"')
+    {
+        if (m_data[m_position] != '\\')
+        {
+            value.push_back(m_data[m_position++]);
+        }
+        else
+        {
+            if (m_position + 1U >= m_data.size())
+                throwMalformed();
+
+            const auto escape = m_data[m_position + 1U];
+            m_position += 2U;
+            switch (escape)
+            {
+                case '"':  value.push_back('"'); break;
+                case '\\': value.push_back('\\'); break;
+                case '/':  value.push_back('/'); break;
+                case 'b':  value.push_back('\b'); break;
+                case 'f':  value.push_back('\f'); break;
+                case 'n':  value.push_back('\n'); break;
+                case 'r':  value.push_back('\r'); break;
+                case 't':  value.push_back('\t'); break;
+                case 'u':
+                {
+                    auto code_unit = [this]
+                        {
+                            if (m_position + 4U > m_data.size())
+                                throwMalformed();
+
+                            std::uint32_t code = 0U;
+                            for (std::size_t i = 0U; i < 4U; ++i)
+                                code = (code << 4U) | hexValue(m_data[m_position++]);
+                            return code;
+                        };
+
+                    auto code_point = code_unit();
+                    if (code_point >= 0xD800U and code_point < 0xDC00U)
+                    {
+                        // Surrogate pair
+                        if (m_data.substr(m_position, 2U) != "\\u")
+                            throwMalformed();
+                        m_position += 2U;
+
+                        const auto low = code_unit();
+                        if (low < 0xDC00U or low >= 0xE000U)
+                            throwMalformed();
+                        code_point = 0x10000U + ((code_point - 0xD800U) << 10U) + (low - 0xDC00U);
+                    }
+                    appendUtf8(value, code_point);
+                    break;
+                }
+                default:
+                    throw IOException("Invalid JSON escape sequence");
+            }
+        }
+
+        if (m_position >= m_data.size())
+            throwMalformed();
+    }
+
+    ++m_position;
+}
+
+auto JsonReader::skipText() -> void
+{
+    ++m_position;
+    while (m_position < m_data.size() and m_data[m_position] != '"')
+        m_position += (m_data[m_position] == '\\') ? 2U : 1U;
+
+    if (m_position >= m_data.size())
+        throwMalformed();
+
+    ++m_position;
+}
+
+auto JsonReader::number() -> std::string_view
+{
+    skipSpace();
+    const auto begin = m_position;
+    while (m_position < m_data.size())
+    {
+        const auto c = m_data[m_position];
+        if ((c < '0' or c > '9') and c != '-' and c != '+' and c != '.' and c != 'e' and c != 'E')
+            break;
+        ++m_position;
+    }
+
+    if (m_position == begin)
+        throwMalformed();
+
+    return m_data.substr(begin, m_position - begin);
+}
+
+auto JsonReader::throwMalformed() -> void
+{
+    throw IOException("Malformed JSON");
+}
+
+} // namespace isml
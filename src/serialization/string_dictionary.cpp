@@ -0,0 +1,97 @@
+/**
+ * @file    string_dictionary.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#include <isml/serialization/string_dictionary.hpp>
+
+#include <algorithm>
+#include <iterator>
+
+#include <isml/exceptions.hpp>
+
+namespace isml {
+
+StringDictionary::StringDictionary(std::size_t capacity, std::size_t max_length)
+    : m_capacity(std::clamp<std::size_t>(capacity, 1U, k_max_capacity))
+    , m_max_length(max_length)
+{
+    // The entries are never moved, so the index can view their strings
+    m_entries.reserve(m_capacity);
+}
+
+auto StringDictionary::accepts(std::string_view value) const noexcept -> bool
+{
+    return !value.empty() and value.size() <= m_max_length;
+}
+
+auto StringDictionary::intern(std::string_view value) -> Lookup
+{
+    if (auto it = m_ids.find(value); it != m_ids.end())
+    {
+        auto& entry = m_entries[it->second];
+        m_recency.splice(m_recency.begin(), m_recency, entry.recency);
+        return { it->second, false };
+    }
+
+    Id id {};
+    if (m_entries.size() < m_capacity)
+    {
+        id = static_cast<Id>(m_entries.size());
+        m_recency.push_front(id);
+        m_entries.push_back({ {}, m_recency.begin(), true });
+    }
+    else
+    {
+        // The least recently used string gives its identifier away
+        id = m_recency.back();
+        m_recency.splice(m_recency.begin(), m_recency, std::prev(m_recency.end()));
+        m_ids.erase(m_entries[id].value);
+    }
+
+    auto& entry = m_entries[id];
+    entry.value.assign(value);
+    m_ids.emplace(entry.value, id);
+    return { id, true };
+}
+
+auto StringDictionary::define(Id id, std::string_view value) -> void
+{
+    if (id >= m_capacity)
+        throw IOException("String identifier is out of range");
+
+    if (id >= m_entries.size())
+        m_entries.resize(id + 1U);
+
+    m_entries[id].value.assign(value);
+    m_entries[id].defined = true;
+}
+
+auto StringDictionary::at(Id id) const -> const std::string&
+{
+    if (id >= m_entries.size() or !m_entries[id].defined)
+        throw IOException("Unknown string identifier");
+
+    return m_entries[id].value;
+}
+
+auto StringDictionary::clear() noexcept -> void
+{
+    // The capacity is kept, so the entries are never moved
+    m_ids.clear();
+    m_recency.clear();
+    m_entries.clear();
+}
+
+auto StringDictionary::size() const noexcept -> std::size_t
+{
+    return m_entries.size();
+}
+
+auto StringDictionary::capacity() const noexcept -> std::size_t
+{
+    return m_capacity;
+}
+
+} // namespace isml
@@ -54,6 +54,18 @@ auto Session::transport() noexcept -> std::unique_ptr<Transport>&
     return m_transport;
 }
 
+auto Session::capabilities() const -> std::optional<SessionCapabilities>
+{
+    std::lock_guard lock { m_capabilities_guard };
+    return m_capabilities;
+}
+
+auto Session::setCapabilities(const SessionCapabilities& capabilities) -> void
+{
+    std::lock_guard lock { m_capabilities_guard };
+    m_capabilities = capabilities;
+}
+
 auto Session::createNew(SessionId session_id, std::unique_ptr<Transport> transport) -> Session::Ptr
 {
     return std::make_shared<Session>(session_id, std::move(transport));
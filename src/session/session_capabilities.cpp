@@ -0,0 +1,39 @@
+/**
+ * @file    session_capabilities.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#include <isml/session/session_capabilities.hpp>
+
+#include <algorithm>
+
+#include <isml/message/message_factory.hpp>
+
+namespace isml {
+
+auto SessionCapabilities::supports(Codec codec) const noexcept -> bool
+{
+    return (codecs & codec) != 0U;
+}
+
+auto SessionCapabilities::local() -> SessionCapabilities
+{
+    SessionCapabilities capabilities;
+    capabilities.schema_fingerprint = MessageFactory::getInstance().fingerprint();
+    return capabilities;
+}
+
+auto SessionCapabilities::negotiate(const SessionCapabilities& local, const SessionCapabilities& remote) noexcept
+    -> SessionCapabilities
+{
+    SessionCapabilities negotiated;
+    negotiated.version = std::min(local.version, remote.version);
+    negotiated.codecs = local.codecs & remote.codecs;
+    negotiated.max_frame_size = std::min(local.max_frame_size, remote.max_frame_size);
+    negotiated.schema_fingerprint = remote.schema_fingerprint;
+    negotiated.schema_match = (local.schema_fingerprint == remote.schema_fingerprint);
+    return negotiated;
+}
+
+} // namespace isml
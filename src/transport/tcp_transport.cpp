@@ -6,34 +6,81 @@
 
 #include <isml/transport/tcp_transport.hpp>
 
-#include <sstream>
 #include <cassert>
 #include <algorithm>
 #include <vector>
+#include <utility>
+#include <string_view>
 
 ISML_DISABLE_WARNINGS_PUSH
 #  include <boost/asio/write.hpp>
 #  include <boost/asio/read.hpp>
+#  include <boost/asio/post.hpp>
 ISML_DISABLE_WARNINGS_POP
 
 #include <isml/serialization/serializers/binary_serializer.hpp>
+#include <isml/serialization/serializers/compact_binary_serializer.hpp>
 #include <isml/serialization/serialization_utility.hpp>
 
 #include <isml/message/message_factory.hpp>
 
+#include <isml/net/socket_zero_copy.hpp>
+
+#include <isml/utility/crc32c.hpp>
+#include <isml/utility/thread_cpu_clock.hpp>
+
 #include <isml/session/session.hpp>
 
 using namespace std::chrono_literals;
 
 namespace isml {
 
-TcpTransport::TcpTransport(TcpSocket socket)
+namespace {
+
+/// Calls the function with the tag of the serializer encoding messages.
+template<typename Fn>
+auto withSerializer(Codec codec, Fn&& fn) -> decltype(auto)
+{
+    if (codec == Codec::CompactBinary)
+        return fn(SerializerTag<CompactBinarySerializer> {});
+
+    return fn(SerializerTag<BinarySerializer> {});
+}
+
+/// Guard of the transport whose task is running on the thread, if any.
+thread_local const void* t_running_guard = nullptr;
+
+} // namespace
+
+TcpTransport::TcpTransport(TcpSocket socket, TransportOptions options)
     : m_socket(std::move(socket))
+    , m_options(options)
+    , m_send_credits(options.credit_window)
 {}
 
 auto TcpTransport::doStart() -> void
 {
     m_state = Service::State::Started;
+
+    if (m_options.timestamping != Timestamping::None)
+    {
+        const auto source = (m_options.timestamping == Timestamping::Hardware)
+                          ? SocketTimestamping::Source::Hardware
+                          : SocketTimestamping::Source::Software;
+
+        if (SocketTimestamping::enable(m_socket.native_handle(), source))
+            m_options.timestamping = Timestamping::None;
+    }
+
+    if (m_options.zero_copy_threshold and SocketZeroCopy::enable(m_socket.native_handle()))
+        m_options.zero_copy_threshold = 0U;
+
+    if (m_options.timestamping != Timestamping::None or m_options.zero_copy_threshold)
+        waitErrorQueue();
+
+    if (m_options.handshake)
+        pushOutgoing(encodeHello());
+
     readMessageLength();
 }
 
@@ -42,6 +89,8 @@ auto TcpTransport::doInit() -> void
 
 auto TcpTransport::doStop() -> void
 {
+    shutdownConnection();
+
     try
     {
         // I'm not sure that we really need to explicitly cancel asynchronous IO
@@ -53,23 +102,97 @@ auto TcpTransport::doStop() -> void
     {
         // Do nothing
     }
+
+    // The encoding and decoding tasks refer to the transport, so the running
+    // ones are waited for and the queued ones won't touch it. Stopped from a
+    // task, the transport must outlive it anyway, and waiting for the other
+    // tasks would deadlock against the lock held by this one
+    if (t_running_guard == m_task_guard.get())
+    {
+        m_task_guard->stopped = true;
+    }
+    else
+    {
+        std::lock_guard lock { m_task_guard->mutex };
+        m_task_guard->stopped = true;
+    }
+
+    // The messages left to the skipped encoding tasks refer to the session,
+    // which would be kept alive by its own transport
+    while (m_encoding_queue.pull()) {}
+
+    // So do the last messages kept as the delta bases
+    {
+        std::lock_guard lock { m_delta_guard };
+        m_sent_bases.clear();
+    }
+
+    m_received_bases.clear();
 }
 
 auto TcpTransport::doSend(Message::Ptr msg) -> void
 {
-    const auto in_progress = m_outgoing_messages.size() > 0;
-    m_outgoing_messages.push(std::move(msg));
-    if (!in_progress)
+    // Unless encoded at once, the message may outlive the bytes its borrowed
+    // values refer to
+    if (m_options.encoding != Encoding::Caller)
+        msg->own();
+
+    switch (m_options.encoding)
     {
-        writeMessage();
+        case Encoding::Caller:
+            pushEncoded(*msg);
+            return;
+
+        case Encoding::Executor:
+            if (m_encoding_executor)
+            {
+                m_encoding_queue.push(std::move(msg));
+                scheduleEncoding();
+            }
+            else
+            {
+                pushEncoded(*msg);
+            }
+            return;
+
+        case Encoding::IoThread:
+            break;
     }
+
+    OutgoingMessage outgoing;
+    outgoing.id = msg->id();
+    outgoing.stream_id = msg->streamId();
+    outgoing.message = std::move(msg);
+    pushOutgoing(std::move(outgoing));
+}
+
+auto TcpTransport::setEncodingExecutor(std::shared_ptr<TaskExecutor> executor) noexcept -> void
+{
+    m_encoding_executor = std::move(executor);
+}
+
+auto TcpTransport::setDecodingExecutor(std::shared_ptr<TaskExecutor> executor) noexcept -> void
+{
+    m_decoding_executor = std::move(executor);
 }
 
 auto TcpTransport::doReceive() -> std::optional<Message::Ptr>
 {
-    return (m_incoming_messages.size() > 0)
-         ? std::make_optional(m_incoming_messages.pull())
-         : std::nullopt;
+    std::unique_lock lock { m_incoming_guard };
+
+    if (m_incoming_messages.size() == 0)
+        return std::nullopt;
+
+    auto message = m_incoming_messages.pull();
+    if (creditsEnabled())
+    {
+        const auto cost = m_incoming_costs.front();
+        m_incoming_costs.pop_front();
+        lock.unlock();
+        grantCredits(cost);
+    }
+
+    return std::make_optional(std::move(message));
 }
 
 auto TcpTransport::doRequest(Message::Ptr msg) -> FutureMessage
@@ -123,29 +246,270 @@ auto TcpTransport::removeExpiredRequests() -> void
     }
 }
 
+auto TcpTransport::options() const noexcept -> const TransportOptions&
+{
+    return m_options;
+}
+
+auto TcpTransport::statistics() const noexcept -> const TransportStatistics&
+{
+    return m_statistics;
+}
+
+auto TcpTransport::scheduleWrite() -> void
+{
+    if (!m_write_in_progress.exchange(true))
+        boost::asio::post(m_socket.get_executor(), [this] { writeMessage(); });
+}
+
+auto TcpTransport::writePending() const -> bool
+{
+    const auto has_data = outgoingPending() or !m_ready_streams.empty();
+    if (has_data and (!creditsEnabled() or m_send_credits > 0))
+        return true;
+
+    return creditsEnabled() and m_pending_grant.load() >= creditThreshold();
+}
+
+auto TcpTransport::outgoingPending() const -> bool
+{
+    std::lock_guard lock { m_outgoing_guard };
+    return !m_outgoing_queue.empty();
+}
+
+auto TcpTransport::pushOutgoing(OutgoingMessage msg) -> void
+{
+    {
+        std::lock_guard lock { m_outgoing_guard };
+        m_outgoing_queue.push_back(std::move(msg));
+    }
+
+    scheduleWrite();
+}
+
+auto TcpTransport::pushEncoded(const Message& msg) -> void
+{
+    std::unique_lock lock { m_delta_guard, std::defer_lock };
+    if (m_options.delta_encoding or m_options.string_dictionary)
+        lock.lock();
+
+    pushOutgoing(encodeMessage(msg));
+}
+
+auto TcpTransport::scheduleEncoding() -> void
+{
+    if (!m_encoding_scheduled.exchange(true))
+        m_encoding_executor->execute([this, guard = m_task_guard] { runTask(this, guard, &TcpTransport::encodePending); });
+}
+
+auto TcpTransport::encodePending() -> void
+{
+    while (auto msg = m_encoding_queue.pull())
+        pushOutgoing(encodeMessage(*msg));
+
+    m_encoding_scheduled = false;
+
+    // A message could arrive after the queue was drained
+    if (m_encoding_queue.size() > 0)
+        scheduleEncoding();
+}
+
+auto TcpTransport::runTask(TcpTransport* transport, const std::shared_ptr<TaskGuard>& guard, TaskMethod task) -> void
+{
+    // A task run inline by another one of the transport holds the lock already
+    std::shared_lock lock { guard->mutex, std::defer_lock };
+    if (t_running_guard != guard.get())
+        lock.lock();
+
+    if (guard->stopped)
+        return;
+
+    const auto* outer = std::exchange(t_running_guard, guard.get());
+    try
+    {
+        (transport->*task)();
+    }
+    catch (...)
+    {
+        t_running_guard = outer;
+        throw;
+    }
+
+    t_running_guard = outer;
+}
+
 auto TcpTransport::writeMessage() -> void
 {
-    auto msg = m_outgoing_messages.pull();
+    const auto started = m_options.accounting ? ThreadCpuClock::now() : ThreadCpuClock::time_point {};
+
+    std::deque<OutgoingMessage> queue;
+    {
+        std::lock_guard lock { m_outgoing_guard };
+        queue.swap(m_outgoing_queue);
+    }
+
+    for (auto& msg : queue)
+    {
+        const auto stream_id = m_options.multiplexing ? msg.stream_id : StreamId {};
+        auto& stream = m_outgoing_streams[stream_id];
+        if (stream.messages.empty() and !stream.current.data)
+            m_ready_streams.push_back(stream_id);
+
+        stream.messages.push_back(std::move(msg));
+    }
+
+    const auto has_credits = !creditsEnabled() or m_send_credits > 0;
+    if (!has_credits and !m_send_stalled and !m_ready_streams.empty())
+    {
+        m_send_stalled = true;
+        ++m_statistics.credit_stalls;
+    }
+
+    const auto has_chunk = has_credits and !m_ready_streams.empty();
+    const auto grant = takeCreditGrant(!has_chunk);
+
+    if (!has_chunk and !grant)
+    {
+        m_write_in_progress = false;
+
+        // Messages or credits could arrive after the checks above
+        if (writePending())
+            scheduleWrite();
+
+        return;
+    }
+
+    StreamId stream_id {};
+    std::string_view chunk;
+    bool first_chunk = true;
+    bool last_chunk = true;
+    bool chunked = false;
+
+    if (has_chunk)
+    {
+        stream_id = m_ready_streams.front();
+        m_ready_streams.pop_front();
+
+        auto& outgoing = m_outgoing_streams[stream_id];
+        if (!outgoing.current.data)
+        {
+            outgoing.current = std::move(outgoing.messages.front());
+            outgoing.messages.pop_front();
+            outgoing.offset = 0U;
+
+            // The message was queued without encoding
+            if (outgoing.current.message)
+                outgoing.current = encodeMessage(*outgoing.current.message);
+        }
 
-    if (!msg) return;
+        const auto& current = outgoing.current;
+        first_chunk = (outgoing.offset == 0U);
+        chunk = std::string_view(current.data.data(), current.size).substr(outgoing.offset);
+        if (m_options.multiplexing)
+            chunk = chunk.substr(0U, m_options.max_chunk_size);
+        else
+            chunk = chunk.substr(0U, TransportOptions::k_max_chunk_size);
 
-    std::stringstream stream;
-    auto context = SerializationContext::create<BinarySerializer>(stream);
+        outgoing.offset += chunk.size();
+        last_chunk = (outgoing.offset == current.size);
 
-    // hack: real message length will be written later
-    m_outgoing_data_length = 0U;
-    m_outgoing_data_length += static_cast<std::uint16_t>(binary::size(m_outgoing_data_length));
-    m_outgoing_data_length += static_cast<std::uint16_t>(binary::size(*msg));
+        // A message not fitting a frame is split even without the multiplexing
+        chunked = !m_options.multiplexing and !(first_chunk and last_chunk);
+    }
+
+    // The marker of a chunked frame precedes the length prefix
+    const auto prefix_length = static_cast<std::uint16_t>(
+        (chunked ? binary::size(k_chunked_frame) : 0U) + binary::size(m_outgoing_data_length));
 
-    serialize<BinarySerializer>(context, m_outgoing_data_length, "");
-    serialize<BinarySerializer>(context, *msg, "");
+    m_outgoing_data_length = prefix_length;
+    if (creditsEnabled())
+        m_outgoing_data_length += static_cast<std::uint16_t>(binary::size(grant));
+
+    const auto header_length = m_outgoing_data_length;
+    if (has_chunk)
+    {
+        if (m_options.multiplexing)
+        {
+            m_outgoing_data_length += static_cast<std::uint16_t>(binary::size(stream_id));
+            m_outgoing_data_length += static_cast<std::uint16_t>(binary::size<FrameFlags>());
+        }
+        else if (chunked)
+        {
+            m_outgoing_data_length += static_cast<std::uint16_t>(binary::size<FrameFlags>());
+        }
 
+        m_outgoing_data_length += static_cast<std::uint16_t>(chunk.size());
+        m_send_credits -= creditCost(m_outgoing_data_length - header_length, last_chunk);
+    }
+
+    if (m_options.frame_checksum)
+        m_outgoing_data_length += static_cast<std::uint16_t>(binary::size<Crc32c::Value>());
+
+    // The length prefix doesn't count itself on the receiving side
+    const auto frame_length = static_cast<MessageLength>(m_outgoing_data_length - prefix_length);
+
+    // The message is already encoded, only the header is written here
     resizeOutgoingDataBuffer();
-    const auto data = stream.str();
-    std::copy(data.cbegin(), data.cend(), m_outgoing_data_buffer.get());
+    BinaryWriter writer { std::span(m_outgoing_data_buffer.data(), m_outgoing_data_length) };
+    TypedSerializationContext<BinarySerializer, BinaryWriter> context { writer };
+
+    if (chunked)
+        serialize<BinarySerializer>(context, k_chunked_frame, "");
+    serialize<BinarySerializer>(context, frame_length, "");
+    if (creditsEnabled())
+        serialize<BinarySerializer>(context, grant, "");
+
+    if (has_chunk and (m_options.multiplexing or chunked))
+    {
+        if (m_options.multiplexing)
+            serialize<BinarySerializer>(context, stream_id, "");
+
+        const auto flags = (first_chunk ? k_first_chunk : 0U) | (last_chunk ? k_last_chunk : 0U);
+        serialize<BinarySerializer>(context, static_cast<FrameFlags>(flags), "");
+    }
+
+    writer.write(chunk.data(), chunk.size());
+
+    if (m_options.frame_checksum)
+        serialize<BinarySerializer>(context, Crc32c::compute(writer.view()), "");
+
+    if (!has_chunk)
+        ++m_statistics.credit_frames;
+
+    MessageId sent_id = k_bad_msg_id;
+    if (has_chunk)
+    {
+        auto& outgoing = m_outgoing_streams[stream_id];
+        if (last_chunk)
+        {
+            sent_id = outgoing.current.id;
+            m_buffer_pool.release(std::move(outgoing.current.data));
+            outgoing.current = {};
+        }
+
+        if (!outgoing.messages.empty() or outgoing.current.data)
+            m_ready_streams.push_back(stream_id);
+        else
+            m_outgoing_streams.erase(stream_id);
+    }
+
+    if (m_options.timestamping != Timestamping::None)
+    {
+        // The kernel identifies transmitted data by the offset of its last byte
+        m_transmit_offset += m_outgoing_data_length;
+        if (sent_id != k_bad_msg_id)
+        {
+            if (m_pending_transmits.size() >= k_max_pending_transmits)
+                m_pending_transmits.erase(m_pending_transmits.begin());
+
+            const auto written = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch());
+            m_pending_transmits.insert_or_assign(m_transmit_offset - 1U, PendingTransmit { sent_id, written });
+        }
+    }
 
     auto handler =
-        [this](const std::error_code& ec, std::size_t /*bytes_transferred*/) mutable
+        [this, sent_message = sent_id != k_bad_msg_id](const std::error_code& ec, std::size_t bytes_transferred) mutable
             {
                 if (disconnected(ec)) return;
 
@@ -156,14 +520,169 @@ auto TcpTransport::writeMessage() -> void
                 }
                 else
                 {
+                    m_statistics.bytes_sent += bytes_transferred;
+                    if (sent_message)
+                        ++m_statistics.messages_sent;
+
                     writeMessage();
                 }
             };
 
-    boost::asio::async_write(m_socket,
-        boost::asio::buffer(m_outgoing_data_buffer.get(), m_outgoing_data_length),
-        boost::asio::transfer_all(),
-        handler);
+    if (m_options.accounting)
+        m_statistics.write_cpu_ns += static_cast<std::uint64_t>((ThreadCpuClock::now() - started).count());
+
+    if (m_options.zero_copy_threshold and m_outgoing_data_length >= m_options.zero_copy_threshold)
+    {
+        writeZeroCopy(0U,
+            [this, handler = std::move(handler)](const std::error_code& ec, std::size_t bytes_transferred) mutable
+                {
+                    retainZeroCopyBuffer();
+                    handler(ec, bytes_transferred);
+                });
+        return;
+    }
+
+    asyncWrite(boost::asio::buffer(m_outgoing_data_buffer.data(), m_outgoing_data_length), handler);
+}
+
+auto TcpTransport::encodeHello() -> OutgoingMessage
+{
+    const auto local = SessionCapabilities::local();
+
+    BinaryWriter writer;
+    withSerializer(m_options.codec, [&]<template<typename...> typename Serializer>(SerializerTag<Serializer>)
+        {
+            TypedSerializationContext<Serializer, BinaryWriter> context { writer };
+            serialize<Serializer>(context, k_hello_message_type, "");
+            serialize<Serializer>(context, local.version, "");
+            serialize<Serializer>(context, local.codecs, "");
+            serialize<Serializer>(context, local.max_frame_size, "");
+            serialize<Serializer>(context, local.schema_fingerprint, "");
+        });
+
+    OutgoingMessage encoded;
+    encoded.size = writer.size();
+    encoded.data = m_buffer_pool.acquire(encoded.size);
+    encoded.id = k_bad_msg_id;
+    std::copy_n(writer.data(), writer.size(), encoded.data.data());
+    return encoded;
+}
+
+auto TcpTransport::encodeMessage(const Message& msg) -> OutgoingMessage
+{
+    const auto started = m_options.accounting ? ThreadCpuClock::now() : ThreadCpuClock::time_point {};
+
+    OutgoingMessage encoded;
+    encoded.id = msg.id();
+    encoded.stream_id = msg.streamId();
+
+    // In the delta mode the message is encoded against the previous one of
+    // the type on the stream unless a keyframe is due
+    const auto stream_id = m_options.multiplexing ? msg.streamId() : StreamId {};
+
+    DeltaBase* delta = nullptr;
+    const Message* base = nullptr;
+    if (m_options.delta_encoding)
+    {
+        delta = &m_sent_bases[deltaKey(stream_id, msg.type())];
+        const auto interval = m_options.keyframe_interval;
+        if (delta->message and (interval == 0U or delta->count % interval != 0U))
+            base = delta->message.get();
+        else
+            delta->count = 0U;
+
+        ++delta->count;
+    }
+
+    // The dictionary is reset every keyframe interval, so that a receiver
+    // which has missed definitions recovers
+    StreamStrings* strings = nullptr;
+    DictionaryFlags dictionary_flags {};
+    if (m_options.string_dictionary)
+    {
+        strings = &streamStrings(m_sent_strings, stream_id);
+        const auto interval = m_options.keyframe_interval;
+        if (interval and strings->count % interval == 0U)
+        {
+            strings->dictionary.clear();
+            dictionary_flags = k_dictionary_reset;
+        }
+
+        ++strings->count;
+    }
+
+    const auto writeMessage = [&]<template<typename...> typename Serializer>(
+        TypedSerializationContext<Serializer, BinaryWriter>& context)
+        {
+            serialize<Serializer>(context, msg.type(), "");
+            if (strings)
+                serialize<Serializer>(context, dictionary_flags, "");
+            if (m_options.delta_encoding)
+                serialize<Serializer>(context, base ? k_delta_frame : k_keyframe, "");
+
+            if (base)
+                msg.serializeDelta(context, *base);
+            else if (m_options.field_presence)
+                msg.serializeSparse(context);
+            else if (m_options.indexed_layout)
+                msg.serializeIndexed(context);
+            else
+                serialize<Serializer>(context, msg, "");
+        };
+
+    if (m_options.codec == Codec::Binary and !m_options.string_dictionary)
+    {
+        // The message is written straight into the pooled buffer
+        encoded.size = binary::size(msg.type());
+        if (m_options.delta_encoding)
+            encoded.size += binary::size<DeltaKind>();
+
+        if (base)
+            encoded.size += msg.deltaSerializedSize(*base);
+        else if (m_options.field_presence)
+            encoded.size += msg.sparseSerializedSize();
+        else if (m_options.indexed_layout)
+            encoded.size += msg.indexedSerializedSize();
+        else
+            encoded.size += msg.serializedSize();
+
+        encoded.data = m_buffer_pool.acquire(encoded.size);
+
+        BinaryWriter writer { std::span(encoded.data.data(), encoded.size) };
+        TypedSerializationContext<BinarySerializer, BinaryWriter> context { writer };
+        writeMessage(context);
+    }
+    else
+    {
+        // The size isn't known in advance (varints, interned strings), so the
+        // message is encoded into a scratch buffer reused by the thread
+        thread_local BinaryWriter writer;
+        writer.clear();
+
+        withSerializer(m_options.codec, [&]<template<typename...> typename Serializer>(SerializerTag<Serializer>)
+            {
+                TypedSerializationContext<Serializer, BinaryWriter> context { writer };
+                if (strings)
+                    context.setDictionary(&strings->dictionary);
+
+                writeMessage(context);
+            });
+
+        encoded.size = writer.size();
+        encoded.data = m_buffer_pool.acquire(encoded.size);
+        std::copy_n(writer.data(), writer.size(), encoded.data.data());
+    }
+
+    if (delta)
+        delta->message = msg.clone();
+
+    if (m_options.accounting)
+    {
+        ++m_statistics.messages_encoded;
+        m_statistics.encode_cpu_ns += static_cast<std::uint64_t>((ThreadCpuClock::now() - started).count());
+    }
+
+    return encoded;
 }
 
 auto TcpTransport::readMessageLength() -> void
@@ -178,17 +697,21 @@ auto TcpTransport::readMessageLength() -> void
                     m_state = Service::State::StopPending;
                     return;
                 }
+                else if (m_incoming_data_length == k_chunked_frame and !m_incoming_chunked)
+                {
+                    // The length of the frame follows the marker
+                    m_incoming_chunked = true;
+                    readMessageLength();
+                }
                 else
                 {
-                    resizeIncomingDataBuffer();
+                    m_frame_timestamp = std::exchange(m_rx_timestamp, {});
+                    acquireIncomingFrame();
                     readMessage();
                 }
             };
 
-    boost::asio::async_read(m_socket,
-        boost::asio::buffer(&m_incoming_data_length, sizeof(m_incoming_data_length)),
-        boost::asio::transfer_all(),
-        handler);
+    asyncRead(boost::asio::buffer(&m_incoming_data_length, sizeof(m_incoming_data_length)), handler);
 }
 
 auto TcpTransport::readMessage() -> void
@@ -206,27 +729,297 @@ auto TcpTransport::readMessage() -> void
                 else
                 {
                     onMessageRead();
+                    m_incoming_frame.reset();
+                    m_incoming_chunked = false;
                     readMessageLength();
                 }
             };
 
-    boost::asio::async_read(m_socket,
-        boost::asio::buffer(m_incoming_data_buffer.get(), m_incoming_data_length),
-        boost::asio::transfer_all(),
-        handler);
+    asyncRead(boost::asio::buffer(m_incoming_frame.data(), m_incoming_data_length), handler);
 }
 
 auto TcpTransport::onMessageRead() -> void
 {
+    m_statistics.bytes_received += binary::size<MessageLength>() + m_incoming_data_length;
+    if (m_incoming_chunked)
+        m_statistics.bytes_received += binary::size(k_chunked_frame);
+
+    if (m_options.frame_checksum and !verifyChecksum())
+        return;
+
+    // Credits of a message which is not queued are returned at once
+    CreditGrant cost = 0U;
+
+    try
+    {
+        BinaryReader reader { std::span<const char>(m_incoming_frame.data(), m_incoming_data_length) };
+        TypedSerializationContext<BinarySerializer, BinaryReader> context { reader };
+
+        std::size_t header_length = 0U;
+        if (creditsEnabled())
+        {
+            CreditGrant grant {};
+            header_length += binary::size(grant);
+            if (m_incoming_data_length < header_length)
+                return;
+
+            deserialize<BinarySerializer>(context, grant, "");
+
+            m_send_credits += grant;
+            if (m_send_credits > 0)
+            {
+                m_send_stalled = false;
+                if (grant and writePending())
+                    scheduleWrite();
+            }
+
+            if (m_incoming_data_length == header_length)
+                return;
+        }
+
+        const auto payload_length = m_incoming_data_length - header_length;
+
+        IncomingFrame frame;
+        frame.timestamp = m_frame_timestamp;
+        bool complete = true;
+
+        if (m_options.multiplexing or m_incoming_chunked)
+        {
+            // A message split without the multiplexing belongs to the stream 0
+            FrameFlags flags {};
+            if (m_options.multiplexing)
+                header_length += binary::size(frame.stream_id);
+            header_length += binary::size(flags);
+            if (m_incoming_data_length < header_length)
+                return;
+
+            if (m_options.multiplexing)
+                deserialize<BinarySerializer>(context, frame.stream_id, "");
+            deserialize<BinarySerializer>(context, flags, "");
+
+            const auto first_chunk = (flags & k_first_chunk) != 0U;
+            const auto last_chunk = (flags & k_last_chunk) != 0U;
+            if (creditsEnabled())
+                cost = creditCost(payload_length, last_chunk);
+
+            auto stream = m_incoming_streams.find(frame.stream_id);
+            if (m_options.frame_checksum)
+            {
+                // The rest of a message whose chunk has been dropped
+                if (!first_chunk and stream == m_incoming_streams.end())
+                    complete = false;
+
+                // The previous message of the stream lost its last chunk
+                if (first_chunk and stream != m_incoming_streams.end())
+                {
+                    m_incoming_streams.erase(stream);
+                    stream = m_incoming_streams.end();
+                    dispatchFrame({ .stream_id = frame.stream_id, .lost = true });
+                }
+            }
+
+            if (complete)
+            {
+                const std::string_view chunk { m_incoming_frame.data() + header_length,
+                                               m_incoming_data_length - header_length };
+
+                // A message sent in a single chunk is decoded in place
+                if (last_chunk and stream == m_incoming_streams.end())
+                {
+                    frame.data = m_incoming_frame;
+                    frame.message = chunk;
+                }
+                else
+                {
+                    if (stream == m_incoming_streams.end())
+                        stream = m_incoming_streams.try_emplace(frame.stream_id).first;
+
+                    auto& data = stream->second;
+                    data.append(chunk);
+
+                    // Credits of the preceding chunks are returned at once
+                    complete = last_chunk;
+                    if (complete)
+                    {
+                        frame.data = SharedBuffer::copy(m_receive_pool, data);
+                        frame.message = frame.data.view();
+                        m_incoming_streams.erase(stream);
+                    }
+                }
+            }
+        }
+        else
+        {
+            if (creditsEnabled())
+                cost = creditCost(payload_length, true);
+
+            // The previous message lost its last chunk
+            if (!m_incoming_streams.empty())
+            {
+                m_incoming_streams.clear();
+                dispatchFrame({ .lost = true });
+            }
+
+            frame.data = m_incoming_frame;
+            frame.message = { m_incoming_frame.data() + header_length, payload_length };
+        }
+
+        if (complete)
+        {
+            frame.cost = std::exchange(cost, 0U);
+            dispatchFrame(std::move(frame));
+        }
+    }
+    catch (const std::exception& ex)
+    {
+        // Do nothing
+    }
+
+    if (cost)
+        grantCredits(cost);
+}
+
+auto TcpTransport::verifyChecksum() -> bool
+{
+    const auto checksum_size = binary::size<Crc32c::Value>();
+
+    if (m_incoming_data_length >= checksum_size)
+    {
+        const auto content_length = m_incoming_data_length - checksum_size;
+
+        // The length prefix (and the marker of a chunked frame) is covered as well
+        Crc32c::Value crc = 0U;
+        if (m_incoming_chunked)
+            crc = Crc32c::compute(&k_chunked_frame, sizeof(k_chunked_frame));
+        crc = Crc32c::compute(&m_incoming_data_length, sizeof(m_incoming_data_length), crc);
+        crc = Crc32c::compute(m_incoming_frame.data(), content_length, crc);
+
+        BinaryReader reader { std::string_view(m_incoming_frame.data() + content_length, checksum_size) };
+        TypedSerializationContext<BinarySerializer, BinaryReader> context { reader };
+        Crc32c::Value checksum {};
+        deserialize<BinarySerializer>(context, checksum, "");
+
+        if (crc == checksum)
+        {
+            m_incoming_data_length = static_cast<MessageLength>(content_length);
+            return true;
+        }
+    }
+
+    ++m_statistics.checksum_failures;
+
+    // Nothing in the frame can be trusted, including the stream it belongs to
+    m_incoming_streams.clear();
+    if (m_options.delta_encoding or m_options.string_dictionary)
+        dispatchFrame({ .lost = true, .any_stream = true });
+
+    if (creditsEnabled())
+    {
+        const auto header_length = binary::size<CreditGrant>() + checksum_size;
+        if (m_incoming_data_length > header_length)
+        {
+            const auto payload_length = m_incoming_data_length - header_length;
+            grantCredits(m_options.flow_control == FlowControl::Bytes ? static_cast<CreditGrant>(payload_length) : 1U);
+        }
+    }
+
+    return false;
+}
+
+auto TcpTransport::scheduleDecoding() -> void
+{
+    if (!m_decoding_scheduled.exchange(true))
+        m_decoding_executor->execute([this, guard = m_task_guard] { runTask(this, guard, &TcpTransport::decodePending); });
+}
+
+auto TcpTransport::decodePending() -> void
+{
+    for (;;)
+    {
+        IncomingFrame frame;
+        {
+            std::lock_guard lock { m_decoding_guard };
+            if (m_decoding_queue.empty())
+                break;
+
+            frame = std::move(m_decoding_queue.front());
+            m_decoding_queue.pop_front();
+        }
+
+        decodeFrame(std::move(frame));
+    }
+
+    m_decoding_scheduled = false;
+
+    // A frame could arrive after the queue was drained
+    std::unique_lock lock { m_decoding_guard };
+    if (!m_decoding_queue.empty())
+    {
+        lock.unlock();
+        scheduleDecoding();
+    }
+}
+
+auto TcpTransport::dispatchFrame(IncomingFrame frame) -> void
+{
+    if (m_options.decoding == Decoding::Executor and m_decoding_executor)
+    {
+        {
+            std::lock_guard lock { m_decoding_guard };
+            m_decoding_queue.push_back(std::move(frame));
+        }
+
+        scheduleDecoding();
+    }
+    else
+    {
+        decodeFrame(std::move(frame));
+    }
+}
+
+auto TcpTransport::decodeFrame(IncomingFrame frame) -> void
+{
+    // The state is reset in the order of the frames, as it is accessed by
+    // the decoding thread only
+    if (frame.lost)
+    {
+        resetDecoding(frame.any_stream ? Maybe<StreamId> { none } : Maybe<StreamId> { frame.stream_id });
+        return;
+    }
+
+    const auto started = m_options.accounting ? ThreadCpuClock::now() : ThreadCpuClock::time_point {};
+
+    // Credits of a message which is not queued are returned at once
+    auto cost = frame.cost;
+
     try
     {
-        std::stringstream stream {
-            std::string(m_incoming_data_buffer.get(),
-                m_incoming_data_buffer.get() + m_incoming_data_length) };
+        // Borrowed fields of the message refer to the frame
+        BinaryReader reader { frame.message, frame.data };
+        auto maybe_message = createMessageFromReader(reader, frame.stream_id);
 
-        if (auto maybe_message = createMessageFromStream(stream))
+        if (m_options.accounting)
+            m_statistics.decode_cpu_ns += static_cast<std::uint64_t>((ThreadCpuClock::now() - started).count());
+
+        if (maybe_message)
         {
+            ++m_statistics.messages_received;
             auto& message = maybe_message.value();
+            message->setStreamId(frame.stream_id);
+
+            if (frame.timestamp)
+            {
+                const auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::system_clock::now().time_since_epoch());
+                message->setTimestamps({ frame.timestamp, now });
+
+                if (frame.timestamp.software.count())
+                {
+                    ++m_statistics.rx_timestamps;
+                    m_statistics.rx_delay_ns += static_cast<std::uint64_t>(
+                        std::max(now - frame.timestamp.software, std::chrono::nanoseconds::zero()).count());
+                }
+            }
 
             bool should_be_queued = true;
             if (message->hasField("srcMsgId"))
@@ -245,43 +1038,417 @@ auto TcpTransport::onMessageRead() -> void
 
             if (should_be_queued)
             {
+                std::lock_guard lock { m_incoming_guard };
                 m_incoming_messages.push(std::move(message));
+                if (creditsEnabled())
+                    m_incoming_costs.push_back(std::exchange(cost, 0U));
             }
         }
     }
     catch (const std::exception& ex)
     {
-        // Do nothing
+        // The definitions following the malformed field are lost
+        if (m_options.string_dictionary)
+            dropReceivedStrings(frame.stream_id);
     }
+
+    if (cost)
+        grantCredits(cost);
 }
 
-auto TcpTransport::createMessageFromStream(std::stringstream& stream) -> Maybe<Message::Ptr>
+auto TcpTransport::createMessageFromReader(BinaryReader& reader, StreamId stream_id) -> Maybe<Message::Ptr>
 {
-    auto context = SerializationContext::create<BinarySerializer>(stream);
+    return withSerializer(m_options.codec, [&]<template<typename...> typename Serializer>(SerializerTag<Serializer>)
+        -> Maybe<Message::Ptr>
+        {
+            TypedSerializationContext<Serializer, BinaryReader> context { reader };
+
+            MessageType type {};
+            deserialize<Serializer>(context, type, "");
+
+            if (m_options.handshake and type == k_hello_message_type)
+            {
+                SessionCapabilities remote;
+                deserialize<Serializer>(context, remote.version, "");
+                deserialize<Serializer>(context, remote.codecs, "");
+                deserialize<Serializer>(context, remote.max_frame_size, "");
+                deserialize<Serializer>(context, remote.schema_fingerprint, "");
+                onHello(remote);
+                return none;
+            }
 
-    MessageType type {};
-    deserialize<BinarySerializer>(context, type, "");
+            StreamStrings* strings = nullptr;
+            if (m_options.string_dictionary)
+            {
+                strings = &streamStrings(m_received_strings, stream_id);
+                context.setDictionary(&strings->dictionary);
+
+                DictionaryFlags flags {};
+                deserialize<Serializer>(context, flags, "");
+                if (flags & k_dictionary_reset)
+                    strings->dictionary.clear();
+            }
+
+            // The strings defined by the fields of an unknown message are lost
+            const auto skip = [&]
+                {
+                    if (strings)
+                        strings->dictionary.clear();
+                    return none;
+                };
+
+            auto& factory = MessageFactory::getInstance();
+
+            assert(m_session);
+            const auto readFields = [&](Message& message)
+                {
+                    if (m_options.field_presence)
+                        message.deserializeSparse(context);
+                    else if (m_options.indexed_layout)
+                        message.deserializeIndexed(context);
+                    else
+                        deserialize<Serializer>(context, message, "");
+                };
+
+            if (!m_options.delta_encoding)
+            {
+                auto message = factory.tryCreateMessage(type, *m_session);
+                if (!message)
+                    return skip();
+
+                readFields(*message);
+                return Maybe { std::move(message) };
+            }
+
+            if (!factory.hasDescriptor(type))
+                return skip();
+
+            DeltaKind kind {};
+            deserialize<Serializer>(context, kind, "");
+            if (kind != k_keyframe and kind != k_delta_frame)
+                throw IOException("Unknown delta frame kind");
+
+            // The changes are applied to the previous message of the type on
+            // the stream. Without it (e.g. it failed to decode) the messages
+            // are dropped until the next keyframe.
+            auto& base = m_received_bases[deltaKey(stream_id, type)].message;
+            if (kind == k_delta_frame and !base)
+            {
+                // The changes are read all the same for the strings they define
+                if (strings)
+                    factory.createMessage(type, *m_session)->deserializeDelta(context);
+                return none;
+            }
+
+            try
+            {
+                if (kind == k_keyframe)
+                {
+                    base = factory.createMessage(type, *m_session);
+                    readFields(*base);
+                }
+                else
+                {
+                    base->deserializeDelta(context);
+                }
+            }
+            catch (...)
+            {
+                base.reset();
+                throw;
+            }
 
-    auto& factory = MessageFactory::getInstance();
-    if (!factory.hasDescriptor(type))
-        return none;
+            return Maybe { base->clone() };
+        });
+}
 
+auto TcpTransport::onHello(const SessionCapabilities& remote) -> void
+{
     assert(m_session);
-    auto message = factory.createMessage(type, *m_session);
-    deserialize<BinarySerializer>(context, *message, "");
+    m_session->setCapabilities(SessionCapabilities::negotiate(SessionCapabilities::local(), remote));
+}
+
+auto TcpTransport::creditsEnabled() const noexcept -> bool
+{
+    return m_options.flow_control != FlowControl::None;
+}
+
+auto TcpTransport::creditCost(std::size_t payload_length, bool last_chunk) const noexcept -> CreditGrant
+{
+    if (m_options.flow_control == FlowControl::Bytes)
+        return static_cast<CreditGrant>(payload_length);
 
-    return Maybe { std::move(message) };
+    return last_chunk ? 1U : 0U;
 }
 
-auto TcpTransport::resizeIncomingDataBuffer() -> void
+auto TcpTransport::creditThreshold() const noexcept -> CreditGrant
 {
-    m_incoming_data_buffer.reset(new char[m_incoming_data_length + 1]);
-    m_incoming_data_buffer[m_incoming_data_length] = '\0';
+    return std::max<CreditGrant>(m_options.credit_window / 2U, 1U);
+}
+
+auto TcpTransport::grantCredits(CreditGrant credits) -> void
+{
+    if (m_pending_grant.fetch_add(credits) + credits >= creditThreshold())
+        scheduleWrite();
+}
+
+auto TcpTransport::takeCreditGrant(bool standalone) -> CreditGrant
+{
+    if (!creditsEnabled())
+        return 0U;
+
+    if (standalone and m_pending_grant.load() < creditThreshold())
+        return 0U;
+
+    return m_pending_grant.exchange(0U);
+}
+
+auto TcpTransport::acquireIncomingFrame() -> void
+{
+    // The block is shared with the messages borrowing from the frame, so a
+    // fresh one is taken for every frame
+    m_incoming_frame = SharedBuffer::create(m_receive_pool, m_incoming_data_length);
 }
 
 auto TcpTransport::resizeOutgoingDataBuffer() -> void
 {
-    m_outgoing_data_buffer.reset(new char[m_outgoing_data_length]);
+    if (m_outgoing_data_buffer.capacity() >= m_outgoing_data_length)
+        return;
+
+    m_buffer_pool.release(std::move(m_outgoing_data_buffer));
+    m_outgoing_data_buffer = m_buffer_pool.acquire(m_outgoing_data_length);
+}
+
+auto TcpTransport::asyncRead(boost::asio::mutable_buffer buffer, IoHandler handler) -> void
+{
+    if (m_options.timestamping != Timestamping::None)
+    {
+        receiveTimestamped(buffer, std::move(handler), 0U);
+        return;
+    }
+
+    boost::asio::async_read(m_socket, buffer, boost::asio::transfer_all(), std::move(handler));
+}
+
+auto TcpTransport::asyncWrite(boost::asio::const_buffer buffer, IoHandler handler) -> void
+{
+    boost::asio::async_write(m_socket, buffer, boost::asio::transfer_all(), std::move(handler));
+}
+
+auto TcpTransport::shutdownConnection() -> void
+{}
+
+auto TcpTransport::receiveTimestamped(boost::asio::mutable_buffer buffer, IoHandler handler, std::size_t transferred) -> void
+{
+    while (buffer.size() > 0U)
+    {
+        auto received = SocketTimestamping::receive(m_socket.native_handle(), buffer.data(), buffer.size(), m_rx_timestamp);
+        if (!received)
+        {
+            const auto& ec = received.error();
+            if (ec != std::errc::resource_unavailable_try_again and ec != std::errc::operation_would_block)
+            {
+                handler(ec, transferred);
+                return;
+            }
+
+            m_socket.async_wait(TcpSocket::wait_read,
+                [this, buffer, transferred, handler = std::move(handler)](const boost::system::error_code& ec) mutable
+                    {
+                        if (ec)
+                            handler(ec, transferred);
+                        else
+                            receiveTimestamped(buffer, std::move(handler), transferred);
+                    });
+            return;
+        }
+
+        if (received.value() == 0U)
+        {
+            handler(boost::system::error_code(boost::asio::error::eof), transferred);
+            return;
+        }
+
+        buffer += received.value();
+        transferred += received.value();
+    }
+
+    // Completion is never invoked from within the initiating function
+    boost::asio::post(m_socket.get_executor(),
+        [transferred, handler = std::move(handler)]
+            {
+                handler({}, transferred);
+            });
+}
+
+auto TcpTransport::waitErrorQueue() -> void
+{
+    m_socket.async_wait(TcpSocket::wait_error,
+        [this](const boost::system::error_code& ec)
+            {
+                if (ec) return;
+
+                const auto notifications = SocketErrorQueue::read(m_socket.native_handle());
+
+                for (const auto& transmitted : notifications.transmitted)
+                    onTransmitted(transmitted);
+
+                for (const auto& completion : notifications.zero_copy)
+                    onZeroCopyCompleted(completion);
+
+                waitErrorQueue();
+            });
+}
+
+auto TcpTransport::onTransmitted(const TransmitTimestamp& transmitted) -> void
+{
+    auto it = m_pending_transmits.find(transmitted.key);
+    if (it == m_pending_transmits.end())
+        return;
+
+    const auto pending = it->second;
+    m_pending_transmits.erase(m_pending_transmits.begin(), std::next(it));
+
+    if (transmitted.timestamp.software.count())
+    {
+        ++m_statistics.tx_timestamps;
+        m_statistics.tx_delay_ns += static_cast<std::uint64_t>(
+            std::max(transmitted.timestamp.software - pending.written, std::chrono::nanoseconds::zero()).count());
+    }
+
+    invoke(&TransportListener::onMessageTransmitted, *this, pending.id, pending.written, transmitted.timestamp);
+}
+
+auto TcpTransport::onZeroCopyCompleted(const ZeroCopyCompletion& completion) -> void
+{
+    if (completion.copied)
+        m_statistics.zero_copy_copied += completion.last - completion.first + 1U;
+
+    // Completions may be reported out of order; the completed calls are
+    // counted up to the first one still in flight
+    m_zero_copy_ahead.push_back(completion);
+    for (auto it = m_zero_copy_ahead.begin(); it != m_zero_copy_ahead.end();)
+    {
+        if (it->first != m_zero_copy_completed)
+        {
+            ++it;
+            continue;
+        }
+
+        m_zero_copy_completed = it->last + 1U;
+        m_zero_copy_ahead.erase(it);
+        it = m_zero_copy_ahead.begin();
+    }
+
+    // A buffer is released once all its send calls are done
+    while (!m_zero_copy_buffers.empty())
+    {
+        const auto& front = m_zero_copy_buffers.front();
+        if (static_cast<std::int32_t>(front.last_call - m_zero_copy_completed) >= 0)
+            break;
+
+        m_buffer_pool.release(std::move(m_zero_copy_buffers.front().buffer));
+        m_zero_copy_buffers.pop_front();
+    }
+}
+
+auto TcpTransport::writeZeroCopy(std::size_t offset, IoHandler handler) -> void
+{
+    while (offset < m_outgoing_data_length)
+    {
+        auto sent = SocketZeroCopy::send(m_socket.native_handle(),
+            m_outgoing_data_buffer.data() + offset, m_outgoing_data_length - offset);
+
+        if (!sent)
+        {
+            const auto& ec = sent.error();
+            if (ec == std::errc::resource_unavailable_try_again or ec == std::errc::operation_would_block)
+            {
+                m_socket.async_wait(TcpSocket::wait_write,
+                    [this, offset, handler = std::move(handler)](const boost::system::error_code& ec) mutable
+                        {
+                            if (ec)
+                                handler(ec, offset);
+                            else
+                                writeZeroCopy(offset, std::move(handler));
+                        });
+                return;
+            }
+
+            if (ec == std::errc::no_buffer_space)
+            {
+                ++m_statistics.zero_copy_fallbacks;
+                asyncWrite(boost::asio::buffer(m_outgoing_data_buffer.data() + offset, m_outgoing_data_length - offset),
+                    [offset, handler = std::move(handler)](const std::error_code& ec, std::size_t bytes_transferred)
+                        {
+                            handler(ec, offset + bytes_transferred);
+                        });
+                return;
+            }
+
+            handler(ec, offset);
+            return;
+        }
+
+        ++m_zero_copy_calls;
+        ++m_frame_zero_copy_calls;
+        offset += sent.value();
+    }
+
+    ++m_statistics.zero_copy_frames;
+
+    // Completion is never invoked from within the initiating function
+    boost::asio::post(m_socket.get_executor(),
+        [offset, handler = std::move(handler)]
+            {
+                handler({}, offset);
+            });
+}
+
+auto TcpTransport::retainZeroCopyBuffer() -> void
+{
+    if (!m_frame_zero_copy_calls)
+        return;
+
+    m_zero_copy_buffers.push_back({ std::move(m_outgoing_data_buffer), m_zero_copy_calls - 1U });
+    m_frame_zero_copy_calls = 0U;
+}
+
+auto TcpTransport::streamStrings(StringDictionaries& dictionaries, StreamId stream_id) -> StreamStrings&
+{
+    auto it = dictionaries.find(stream_id);
+    if (it == dictionaries.end())
+        it = dictionaries.try_emplace(stream_id, m_options.string_dictionary).first;
+
+    return it->second;
+}
+
+auto TcpTransport::resetDecoding(Maybe<StreamId> stream_id) -> void
+{
+    if (stream_id.isNone())
+    {
+        m_received_bases.clear();
+        for (auto& [_, strings] : m_received_strings)
+            strings.dictionary.clear();
+        return;
+    }
+
+    std::erase_if(m_received_bases, [&](const auto& entry)
+        {
+            return static_cast<StreamId>(entry.first >> 16U) == *stream_id;
+        });
+    dropReceivedStrings(*stream_id);
+}
+
+auto TcpTransport::dropReceivedStrings(StreamId stream_id) -> void
+{
+    if (const auto it = m_received_strings.find(stream_id); it != m_received_strings.end())
+        it->second.dictionary.clear();
+}
+
+auto TcpTransport::deltaKey(StreamId stream_id, MessageType type) noexcept -> std::uint32_t
+{
+    return (static_cast<std::uint32_t>(stream_id) << 16U) | type;
 }
 
 auto TcpTransport::disconnected(const std::error_code& ec) -> bool
@@ -19,6 +19,31 @@ TcpTransportFactory::TcpTransportFactory(boost::asio::io_context& ioc) noexcept
 {}
 
 auto TcpTransportFactory::createTransport(const Url& url) noexcept -> Result<Transport::Ptr, std::error_code>
+{
+    TransportOptions options;
+    try
+    {
+        options = TransportOptions::fromUrl(url);
+    }
+    catch (const std::exception&)
+    {
+        return Failure { std::make_error_code(std::errc::invalid_argument) };
+    }
+
+    auto socket_res = connect(url);
+    if (!socket_res) return Failure { socket_res.error() };
+
+    std::unique_ptr<Transport> transport { new TcpTransport(std::move(socket_res.value()), options) };
+
+    return Success { std::move(transport) };
+}
+
+auto TcpTransportFactory::supports(const std::string& protocol) const noexcept -> bool
+{
+    return protocol == "tcp";
+}
+
+auto TcpTransportFactory::connect(const Url& url) noexcept -> Result<TcpSocket, std::error_code>
 {
     boost::asio::ip::tcp::resolver resolver { m_ioc.get() };
 
@@ -34,14 +59,7 @@ auto TcpTransportFactory::createTransport(const Url& url) noexcept -> Result<Tra
 
     if (ec) return Failure { std::error_code(ec.value(), std::system_category()) };
 
-    std::unique_ptr<Transport> transport { new TcpTransport(std::move(socket)) };
-
-    return Success { std::move(transport) };
-}
-
-auto TcpTransportFactory::supports(const std::string& protocol) const noexcept -> bool
-{
-    return protocol == "tcp";
+    return Success { std::move(socket) };
 }
 
 } // namespace isml
@@ -0,0 +1,80 @@
+/**
+ * @file    tls_session_cache.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#include <isml/transport/tls_session_cache.hpp>
+
+#include <utility>
+
+namespace isml {
+
+namespace {
+
+struct Binding
+{
+    TlsSessionCache* cache;
+    std::string      key;
+};
+
+auto freeBinding(void*, void* ptr, CRYPTO_EX_DATA*, int, long, void*) -> void
+{
+    delete static_cast<Binding*>(ptr);
+}
+
+auto bindingIndex() -> int
+{
+    static const int index = SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, freeBinding);
+    return index;
+}
+
+auto onNewSession(SSL* ssl, SSL_SESSION* session) -> int
+{
+    auto* binding = static_cast<Binding*>(SSL_get_ex_data(ssl, bindingIndex()));
+    if (!binding)
+        return 0;
+
+    // The cache takes over the reference
+    binding->cache->store(binding->key, session);
+    return 1;
+}
+
+} // namespace
+
+auto TlsSessionCache::attach(SSL_CTX* context) noexcept -> void
+{
+    SSL_CTX_set_session_cache_mode(context, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+    SSL_CTX_sess_set_new_cb(context, onNewSession);
+}
+
+auto TlsSessionCache::bind(SSL* ssl, const std::string& key) -> void
+{
+    {
+        std::lock_guard lock { m_sessions_guard };
+        if (auto it = m_sessions.find(key); it != m_sessions.end())
+            SSL_set_session(ssl, it->second.get());
+    }
+
+    SSL_set_ex_data(ssl, bindingIndex(), new Binding { this, key });
+}
+
+auto TlsSessionCache::store(const std::string& key, SSL_SESSION* session) -> void
+{
+    std::lock_guard lock { m_sessions_guard };
+    m_sessions.insert_or_assign(key, SessionPtr { session, SSL_SESSION_free });
+}
+
+auto TlsSessionCache::contains(const std::string& key) const -> bool
+{
+    std::lock_guard lock { m_sessions_guard };
+    return m_sessions.contains(key);
+}
+
+auto TlsSessionCache::erase(const std::string& key) -> void
+{
+    std::lock_guard lock { m_sessions_guard };
+    m_sessions.erase(key);
+}
+
+} // namespace isml
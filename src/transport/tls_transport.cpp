@@ -0,0 +1,240 @@
+/**
+ * @file    tls_transport.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#include <isml/transport/tls_transport.hpp>
+
+#include <utility>
+
+ISML_DISABLE_WARNINGS_PUSH
+#  include <boost/asio/dispatch.hpp>
+#  include <boost/asio/io_context.hpp>
+#  include <boost/asio/ip/address.hpp>
+#  include <boost/asio/read.hpp>
+#  include <boost/asio/write.hpp>
+#  include <openssl/err.h>
+#  include <openssl/x509v3.h>
+ISML_DISABLE_WARNINGS_POP
+
+namespace isml {
+
+TlsTransport::TlsTransport(TcpSocket socket, SslContext& context, TransportOptions options)
+    : TcpTransport(std::move(socket), options)
+    , m_stream(m_socket, context)
+{
+    // Records don't match the frames, so the socket timestamps can't be
+    // attributed to messages, and the frames are encrypted before sending
+    m_options.timestamping = Timestamping::None;
+    m_options.zero_copy_threshold = 0U;
+}
+
+auto TlsTransport::setSessionCache(std::shared_ptr<TlsSessionCache> cache, std::string key) -> void
+{
+    m_session_cache = std::move(cache);
+    m_session_key = std::move(key);
+}
+
+auto TlsTransport::handshake(HandshakeType type, const std::string& hostname, bool ktls) -> std::error_code
+{
+#if defined(SSL_OP_ENABLE_KTLS)
+    if (ktls)
+        return kernelHandshake(type, hostname);
+#else
+    static_cast<void>(ktls);
+#endif
+
+    prepare(m_stream.native_handle(), type, hostname);
+
+    boost::system::error_code ec;
+    m_stream.handshake(type, ec);
+    if (ec)
+        return ec;
+
+    m_session_reused = SSL_session_reused(m_stream.native_handle()) == 1;
+    return {};
+}
+
+auto TlsTransport::asyncHandshake(HandshakeType type, const std::string& hostname, HandshakeHandler handler) -> void
+{
+    prepare(m_stream.native_handle(), type, hostname);
+
+    m_stream.async_handshake(type, [this, handler = std::move(handler)](const boost::system::error_code& ec)
+        {
+            if (!ec)
+                m_session_reused = SSL_session_reused(m_stream.native_handle()) == 1;
+
+            handler(ec);
+        });
+}
+
+auto TlsTransport::asyncAccept(TcpSocket socket, SslContext& context, TransportOptions options, AcceptHandler handler) -> void
+{
+    // The handler is copyable, so the transport is shared until it is handed over
+    auto transport = std::make_shared<std::unique_ptr<TlsTransport>>(
+        std::make_unique<TlsTransport>(std::move(socket), context, options));
+
+    auto& server = **transport;
+    server.asyncHandshake(HandshakeType::server, {}, [transport, handler = std::move(handler)](const std::error_code& ec)
+        {
+            if (ec)
+            {
+                handler(Failure { ec });
+                return;
+            }
+
+            handler(Success { Transport::Ptr { std::move(*transport) } });
+        });
+}
+
+auto TlsTransport::kernelOffloaded() const noexcept -> bool
+{
+    return m_kernel_offload;
+}
+
+auto TlsTransport::sessionReused() const noexcept -> bool
+{
+    return m_session_reused;
+}
+
+auto TlsTransport::asyncRead(boost::asio::mutable_buffer buffer, IoHandler handler) -> void
+{
+    if (m_kernel_offload)
+    {
+        TcpTransport::asyncRead(buffer, std::move(handler));
+        return;
+    }
+
+    boost::asio::async_read(m_stream, buffer, boost::asio::transfer_all(), std::move(handler));
+}
+
+auto TlsTransport::asyncWrite(boost::asio::const_buffer buffer, IoHandler handler) -> void
+{
+    if (m_kernel_offload)
+    {
+        TcpTransport::asyncWrite(buffer, std::move(handler));
+        return;
+    }
+
+    boost::asio::async_write(m_stream, buffer, boost::asio::transfer_all(), std::move(handler));
+}
+
+auto TlsTransport::shutdownConnection() -> void
+{
+    if (m_task_guard->stopped)
+        return;
+
+    m_close_notify = std::make_shared<std::promise<void>>();
+    auto sent = m_close_notify->get_future();
+
+    // The stream is used by the read and write loops, so the alert is sent
+    // on the socket executor. Stopped there, the transport can't wait for
+    // the write, which is attempted at once anyway
+    const auto socket_executor = m_socket.get_executor();
+    const auto* executor = socket_executor.target<boost::asio::io_context::executor_type>();
+    if (executor and executor->running_in_this_thread())
+    {
+        runTask(this, m_task_guard, static_cast<TaskMethod>(&TlsTransport::sendCloseNotify));
+        return;
+    }
+
+    boost::asio::dispatch(m_socket.get_executor(), [this, guard = m_task_guard]
+        {
+            runTask(this, guard, static_cast<TaskMethod>(&TlsTransport::sendCloseNotify));
+        });
+
+    // A peer which doesn't read the connection doesn't hold the stop up
+    sent.wait_for(k_close_notify_timeout);
+}
+
+auto TlsTransport::sendCloseNotify() -> void
+{
+    auto sent = std::move(m_close_notify);
+
+    if (m_kernel_ssl)
+    {
+        // The kernel sends the alert as a control record
+        if (SSL_is_init_finished(m_kernel_ssl.get()))
+            SSL_shutdown(m_kernel_ssl.get());
+
+        sent->set_value();
+        return;
+    }
+
+    auto* ssl = m_stream.native_handle();
+    if (!SSL_is_init_finished(ssl))
+    {
+        sent->set_value();
+        return;
+    }
+
+    // The shutdown completes once the alert is written instead of waiting for
+    // the one of the peer
+    SSL_set_shutdown(ssl, SSL_get_shutdown(ssl) | SSL_RECEIVED_SHUTDOWN);
+    m_stream.async_shutdown([sent](const boost::system::error_code&) { sent->set_value(); });
+}
+
+auto TlsTransport::kernelHandshake(HandshakeType type, const std::string& hostname) -> std::error_code
+{
+#if defined(SSL_OP_ENABLE_KTLS)
+    m_kernel_ssl.reset(SSL_new(SSL_get_SSL_CTX(m_stream.native_handle())));
+    if (!m_kernel_ssl)
+        return std::make_error_code(std::errc::not_enough_memory);
+
+    auto* ssl = m_kernel_ssl.get();
+
+    // Linux accepts the receiving side of TLS 1.3 connections only on recent
+    // kernels and post-handshake messages (tickets, key updates) would break
+    // plain socket reads, so the offloaded connection is limited to TLS 1.2.
+    SSL_set_max_proto_version(ssl, TLS1_2_VERSION);
+    SSL_set_options(ssl, SSL_OP_ENABLE_KTLS);
+    SSL_set_fd(ssl, static_cast<int>(m_socket.native_handle()));
+    prepare(ssl, type, hostname);
+
+    ERR_clear_error();
+    const auto rc = (type == HandshakeType::client) ? SSL_connect(ssl) : SSL_accept(ssl);
+    if (rc != 1)
+    {
+        ERR_clear_error();
+        m_kernel_ssl.reset();
+        return std::make_error_code(std::errc::protocol_error);
+    }
+
+    m_session_reused = SSL_session_reused(ssl) == 1;
+    m_kernel_offload = BIO_get_ktls_send(SSL_get_wbio(ssl)) == 1
+                   and BIO_get_ktls_recv(SSL_get_rbio(ssl)) == 1;
+    return {};
+#else
+    static_cast<void>(type);
+    static_cast<void>(hostname);
+    return std::make_error_code(std::errc::operation_not_supported);
+#endif
+}
+
+auto TlsTransport::prepare(SSL* ssl, HandshakeType type, const std::string& hostname) -> void
+{
+    if (type != HandshakeType::client)
+        return;
+
+    if (!hostname.empty())
+    {
+        boost::system::error_code ec;
+        boost::asio::ip::make_address(hostname, ec);
+        if (ec)
+        {
+            // Server name indication is defined for host names only
+            SSL_set_tlsext_host_name(ssl, hostname.c_str());
+            SSL_set1_host(ssl, hostname.c_str());
+        }
+        else
+        {
+            X509_VERIFY_PARAM_set1_ip_asc(SSL_get0_param(ssl), hostname.c_str());
+        }
+    }
+
+    if (m_session_cache)
+        m_session_cache->bind(ssl, m_session_key);
+}
+
+} // namespace isml
@@ -0,0 +1,77 @@
+/**
+ * @file    tls_transport_factory.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#include <isml/transport/tls_transport_factory.hpp>
+
+#include <isml/transport/tls_transport.hpp>
+
+namespace isml {
+
+TlsTransportFactory::TlsTransportFactory(boost::asio::io_context& ioc, boost::asio::ssl::context& context) noexcept
+    : TcpTransportFactory(ioc)
+    , m_context(context)
+    , m_session_cache(std::make_shared<TlsSessionCache>())
+{
+    TlsSessionCache::attach(m_context.get().native_handle());
+}
+
+auto TlsTransportFactory::createTransport(const Url& url) noexcept -> Result<Transport::Ptr, std::error_code>
+{
+    const auto ktls = url.parameter("ktls") == std::string("1");
+
+    auto transport_res = createTransport(url, ktls);
+    if (transport_res or !ktls)
+        return transport_res;
+
+    // The kernel refused the offload, use the user-space record layer
+    return createTransport(url, false);
+}
+
+auto TlsTransportFactory::supports(const std::string& protocol) const noexcept -> bool
+{
+    return protocol == "tls";
+}
+
+auto TlsTransportFactory::sessionCache() noexcept -> TlsSessionCache&
+{
+    return *m_session_cache;
+}
+
+auto TlsTransportFactory::createTransport(const Url& url, bool ktls) noexcept -> Result<Transport::Ptr, std::error_code>
+{
+    TransportOptions options;
+    try
+    {
+        options = TransportOptions::fromUrl(url);
+    }
+    catch (const std::exception&)
+    {
+        return Failure { std::make_error_code(std::errc::invalid_argument) };
+    }
+
+    try
+    {
+        auto socket_res = connect(url);
+        if (!socket_res) return Failure { socket_res.error() };
+
+        auto transport = std::make_unique<TlsTransport>(std::move(socket_res.value()), m_context.get(), options);
+        transport->setSessionCache(m_session_cache, url.hostname() + ":" + std::to_string(url.port()));
+
+        const auto ec = transport->handshake(TlsTransport::HandshakeType::client, url.hostname(), ktls);
+        if (ec) return Failure { ec };
+
+        if (ktls and !transport->kernelOffloaded())
+            return Failure { std::make_error_code(std::errc::operation_not_supported) };
+
+        return Success { Transport::Ptr { std::move(transport) } };
+    }
+    catch (const std::exception&)
+    {
+        return Failure { std::make_error_code(std::errc::not_enough_memory) };
+    }
+}
+
+} // namespace isml
@@ -0,0 +1,140 @@
+/**
+ * @file    transport_options.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#include <isml/transport/transport_options.hpp>
+
+#include <stdexcept>
+#include <string>
+
+namespace isml {
+
+auto TransportOptions::fromUrl(const Url& url) -> TransportOptions
+{
+    TransportOptions options;
+
+    if (auto credits = url.parameter("credits"))
+    {
+        if (credits.value() == "messages")
+            options.flow_control = FlowControl::Messages;
+        else if (credits.value() == "bytes")
+            options.flow_control = FlowControl::Bytes;
+        else
+            throw std::invalid_argument("Unknown flow control mode: " + credits.value());
+    }
+
+    std::uint32_t window = 0U;
+    if (auto value = url.parameter("window"))
+        window = static_cast<std::uint32_t>(std::stoul(value.value()));
+
+    options = withCredits(options.flow_control, window);
+
+    if (auto streams = url.parameter("streams"))
+        options.multiplexing = (streams.value() == "1");
+
+    if (auto chunk = url.parameter("chunk"))
+    {
+        options.max_chunk_size = static_cast<std::uint32_t>(std::stoul(chunk.value()));
+        if (!options.max_chunk_size or options.max_chunk_size > k_max_chunk_size)
+            throw std::invalid_argument("Invalid chunk size: " + chunk.value());
+    }
+
+    if (auto timestamps = url.parameter("timestamps"))
+    {
+        if (timestamps.value() == "software")
+            options.timestamping = Timestamping::Software;
+        else if (timestamps.value() == "hardware")
+            options.timestamping = Timestamping::Hardware;
+        else
+            throw std::invalid_argument("Unknown timestamp source: " + timestamps.value());
+    }
+
+    if (auto zero_copy = url.parameter("zerocopy"))
+        options.zero_copy_threshold = static_cast<std::uint32_t>(std::stoul(zero_copy.value()));
+
+    if (auto codec = url.parameter("codec"))
+    {
+        if (codec.value() == "binary")
+            options.codec = Codec::Binary;
+        else if (codec.value() == "compact")
+            options.codec = Codec::CompactBinary;
+        else
+            throw std::invalid_argument("Unknown codec: " + codec.value());
+    }
+
+    if (auto presence = url.parameter("presence"))
+        options.field_presence = (presence.value() == "1");
+
+    if (auto delta = url.parameter("delta"))
+        options.delta_encoding = (delta.value() == "1");
+
+    if (auto keyframe = url.parameter("keyframe"))
+        options.keyframe_interval = static_cast<std::uint32_t>(std::stoul(keyframe.value()));
+
+    if (auto indexed = url.parameter("indexed"))
+        options.indexed_layout = (indexed.value() == "1");
+
+    if (auto dictionary = url.parameter("dictionary"))
+        options.string_dictionary = static_cast<std::uint32_t>(std::stoul(dictionary.value()));
+
+    if (auto crc = url.parameter("crc"))
+        options.frame_checksum = (crc.value() == "1");
+
+    if (auto handshake = url.parameter("handshake"))
+        options.handshake = (handshake.value() == "1");
+
+    if (auto encode = url.parameter("encode"))
+    {
+        if (encode.value() == "io")
+            options.encoding = Encoding::IoThread;
+        else if (encode.value() == "caller")
+            options.encoding = Encoding::Caller;
+        else if (encode.value() == "executor")
+            options.encoding = Encoding::Executor;
+        else
+            throw std::invalid_argument("Unknown encoding mode: " + encode.value());
+    }
+
+    if (auto decode = url.parameter("decode"))
+    {
+        if (decode.value() == "io")
+            options.decoding = Decoding::IoThread;
+        else if (decode.value() == "executor")
+            options.decoding = Decoding::Executor;
+        else
+            throw std::invalid_argument("Unknown decoding mode: " + decode.value());
+    }
+
+    if (auto accounting = url.parameter("accounting"))
+        options.accounting = (accounting.value() == "1");
+
+    // Fields decoded on access are read out of order and in full
+    if (options.indexed_layout and (options.field_presence or options.delta_encoding or options.string_dictionary))
+        throw std::invalid_argument("Indexed layout can't be combined with presence, delta or dictionary");
+
+    return options;
+}
+
+auto TransportOptions::withCredits(FlowControl mode, std::uint32_t window) -> TransportOptions
+{
+    TransportOptions options;
+    options.flow_control = mode;
+
+    switch (mode)
+    {
+        case FlowControl::None:
+            break;
+        case FlowControl::Messages:
+            options.credit_window = window ? window : k_default_message_window;
+            break;
+        case FlowControl::Bytes:
+            options.credit_window = window ? window : k_default_byte_window;
+            break;
+    }
+
+    return options;
+}
+
+} // namespace isml
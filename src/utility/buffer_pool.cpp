@@ -0,0 +1,115 @@
+/**
+ * @file    buffer_pool.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#include <isml/utility/buffer_pool.hpp>
+
+#include <bit>
+#include <new>
+#include <utility>
+
+namespace isml {
+
+BufferPool::Buffer::Buffer(Buffer&& other) noexcept
+    : m_data(std::move(other.m_data))
+    , m_capacity(std::exchange(other.m_capacity, 0U))
+{}
+
+auto BufferPool::Buffer::operator=(Buffer&& other) noexcept -> Buffer&
+{
+    m_data = std::move(other.m_data);
+    m_capacity = std::exchange(other.m_capacity, 0U);
+    return *this;
+}
+
+auto BufferPool::Buffer::data() noexcept -> char*
+{
+    return m_data.get();
+}
+
+auto BufferPool::Buffer::data() const noexcept -> const char*
+{
+    return m_data.get();
+}
+
+auto BufferPool::Buffer::capacity() const noexcept -> std::size_t
+{
+    return m_capacity;
+}
+
+BufferPool::Buffer::operator bool() const noexcept
+{
+    return static_cast<bool>(m_data);
+}
+
+BufferPool::BufferPool(std::size_t max_cached_buffers)
+    : m_max_cached_buffers(max_cached_buffers)
+{}
+
+auto BufferPool::acquire(std::size_t size) -> Buffer
+{
+    const auto index = capacityClass(size);
+    if (index >= k_capacity_classes)
+        throw std::bad_alloc();
+
+    {
+        std::lock_guard lock { m_guard };
+        auto& free_list = m_free_lists[index];
+        if (!free_list.empty())
+        {
+            auto buffer = std::move(free_list.back());
+            free_list.pop_back();
+            ++m_hits;
+            return buffer;
+        }
+    }
+
+    ++m_misses;
+
+    Buffer buffer;
+    buffer.m_capacity = std::size_t { 1U } << (index + k_min_capacity_log2);
+    buffer.m_data.reset(new char[buffer.m_capacity]);
+    return buffer;
+}
+
+auto BufferPool::release(Buffer buffer) noexcept -> void
+{
+    if (!buffer)
+        return;
+
+    const auto index = capacityClass(buffer.m_capacity);
+
+    std::lock_guard lock { m_guard };
+    auto& free_list = m_free_lists[index];
+    if (free_list.size() < m_max_cached_buffers)
+    {
+        try
+        {
+            free_list.push_back(std::move(buffer));
+        }
+        catch (const std::exception&)
+        {
+            // Do nothing: the buffer is freed
+        }
+    }
+}
+
+auto BufferPool::hits() const noexcept -> std::uint64_t
+{
+    return m_hits;
+}
+
+auto BufferPool::misses() const noexcept -> std::uint64_t
+{
+    return m_misses;
+}
+
+auto BufferPool::capacityClass(std::size_t size) noexcept -> std::size_t
+{
+    const auto log2 = static_cast<std::size_t>(std::bit_width(size > 1U ? size - 1U : std::size_t { 1U }));
+    return (log2 > k_min_capacity_log2) ? log2 - k_min_capacity_log2 : 0U;
+}
+
+} // namespace isml
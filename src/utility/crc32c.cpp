@@ -0,0 +1,226 @@
+/**
+ * @file    crc32c.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#include <isml/utility/crc32c.hpp>
+
+#include <array>
+#include <bit>
+#include <cstring>
+
+#if defined(__x86_64__)
+#   include <immintrin.h>
+#   define ISML_CRC32C_X86
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#   include <arm_acle.h>
+#   define ISML_CRC32C_ARM
+#endif
+
+namespace isml {
+
+namespace {
+
+using Value = Crc32c::Value;
+using Tables = std::array<std::array<Value, 256U>, 8U>;
+
+constexpr Value k_polynomial = 0x82F63B78U; ///< Bit-reflected Castagnoli polynomial.
+
+constexpr auto makeTables() noexcept -> Tables
+{
+    Tables tables {};
+    for (Value i = 0U; i < 256U; ++i)
+    {
+        auto crc = i;
+        for (int bit = 0; bit < 8; ++bit)
+            crc = (crc & 1U) ? (crc >> 1U) ^ k_polynomial : crc >> 1U;
+        tables[0][i] = crc;
+    }
+
+    for (std::size_t table = 1U; table < tables.size(); ++table)
+        for (std::size_t i = 0U; i < 256U; ++i)
+            tables[table][i] = (tables[table - 1U][i] >> 8U) ^ tables[0][tables[table - 1U][i] & 0xFFU];
+
+    return tables;
+}
+
+constexpr Tables k_tables = makeTables();
+
+auto load64(const unsigned char* data) noexcept -> std::uint64_t
+{
+    std::uint64_t value;
+    std::memcpy(&value, data, sizeof value);
+    return value;
+}
+
+/// Raw (not inverted) checksum register update.
+auto updatePortable(Value crc, const unsigned char* data, std::size_t size) noexcept -> Value
+{
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        for (; size >= 8U; size -= 8U, data += 8U)
+        {
+            const auto word = load64(data) ^ crc;
+            crc = k_tables[7][word & 0xFFU] ^
+                  k_tables[6][(word >> 8U) & 0xFFU] ^
+                  k_tables[5][(word >> 16U) & 0xFFU] ^
+                  k_tables[4][(word >> 24U) & 0xFFU] ^
+                  k_tables[3][(word >> 32U) & 0xFFU] ^
+                  k_tables[2][(word >> 40U) & 0xFFU] ^
+                  k_tables[1][(word >> 48U) & 0xFFU] ^
+                  k_tables[0][word >> 56U];
+        }
+    }
+
+    for (; size; --size, ++data)
+        crc = (crc >> 8U) ^ k_tables[0][(crc ^ *data) & 0xFFU];
+
+    return crc;
+}
+
+#if defined(ISML_CRC32C_X86)
+
+/// Bytes of each of the three lanes processed at once.
+constexpr std::size_t k_lane_size = 256U;
+
+/// Multiplies polynomials modulo the CRC polynomial (bit-reflected).
+constexpr auto multiplyModulo(Value a, Value b) noexcept -> Value
+{
+    Value product = 0U;
+    for (Value mask = 1U << 31U; mask; mask >>= 1U)
+    {
+        if (a & mask)
+            product ^= b;
+        b = (b & 1U) ? (b >> 1U) ^ k_polynomial : b >> 1U;
+    }
+    return product;
+}
+
+/// x^n modulo the CRC polynomial (bit-reflected).
+constexpr auto powerModulo(std::size_t n) noexcept -> Value
+{
+    Value result = 1U << 31U;  // x^0
+    Value square = 1U << 30U;  // x^1
+    for (; n; n >>= 1U)
+    {
+        if (n & 1U)
+            result = multiplyModulo(square, result);
+        square = multiplyModulo(square, square);
+    }
+    return result;
+}
+
+// The carry-less product of two reflected 32-bit values is shifted by one
+// bit and the crc32 instruction multiplies it by x^32, hence 33
+constexpr Value k_one_lane_shift = powerModulo(8U * k_lane_size - 33U);
+constexpr Value k_two_lanes_shift = powerModulo(16U * k_lane_size - 33U);
+
+__attribute__((target("sse4.2,pclmul")))
+auto shift(Value crc, Value constant) noexcept -> Value
+{
+    const auto product = _mm_clmulepi64_si128(_mm_cvtsi32_si128(static_cast<int>(crc)),
+                                              _mm_cvtsi32_si128(static_cast<int>(constant)), 0x00);
+    return static_cast<Value>(_mm_crc32_u64(0U, static_cast<std::uint64_t>(_mm_cvtsi128_si64(product))));
+}
+
+template<bool Interleaved>
+__attribute__((target("sse4.2,pclmul")))
+auto updateHardware(Value crc, const unsigned char* data, std::size_t size) noexcept -> Value
+{
+    if constexpr (Interleaved)
+    {
+        for (; size >= 3U * k_lane_size; size -= 3U * k_lane_size, data += 3U * k_lane_size)
+        {
+            std::uint64_t crc0 = crc;
+            std::uint64_t crc1 = 0U;
+            std::uint64_t crc2 = 0U;
+            for (std::size_t i = 0U; i < k_lane_size; i += 8U)
+            {
+                crc0 = _mm_crc32_u64(crc0, load64(data + i));
+                crc1 = _mm_crc32_u64(crc1, load64(data + k_lane_size + i));
+                crc2 = _mm_crc32_u64(crc2, load64(data + 2U * k_lane_size + i));
+            }
+
+            crc = shift(static_cast<Value>(crc0), k_two_lanes_shift) ^
+                  shift(static_cast<Value>(crc1), k_one_lane_shift) ^
+                  static_cast<Value>(crc2);
+        }
+    }
+
+    std::uint64_t crc64 = crc;
+    for (; size >= 8U; size -= 8U, data += 8U)
+        crc64 = _mm_crc32_u64(crc64, load64(data));
+
+    crc = static_cast<Value>(crc64);
+    for (; size; --size, ++data)
+        crc = _mm_crc32_u8(crc, *data);
+
+    return crc;
+}
+
+using Update = Value (*)(Value, const unsigned char*, std::size_t) noexcept;
+
+auto selectUpdate() noexcept -> Update
+{
+    __builtin_cpu_init();
+    if (!__builtin_cpu_supports("sse4.2"))
+        return updatePortable;
+
+    return __builtin_cpu_supports("pclmul") ? updateHardware<true> : updateHardware<false>;
+}
+
+/// Selected once, on the first use.
+auto update() noexcept -> Update
+{
+    static const Update selected = selectUpdate();
+    return selected;
+}
+
+#elif defined(ISML_CRC32C_ARM)
+
+auto updateHardware(Value crc, const unsigned char* data, std::size_t size) noexcept -> Value
+{
+    for (; size >= 8U; size -= 8U, data += 8U)
+        crc = __crc32cd(crc, load64(data));
+
+    for (; size; --size, ++data)
+        crc = __crc32cb(crc, *data);
+
+    return crc;
+}
+
+#endif
+
+} // namespace
+
+auto Crc32c::compute(const void* data, std::size_t size, Value crc) noexcept -> Value
+{
+    const auto* bytes = static_cast<const unsigned char*>(data);
+
+#if defined(ISML_CRC32C_X86)
+    return ~update()(~crc, bytes, size);
+#elif defined(ISML_CRC32C_ARM)
+    return ~updateHardware(~crc, bytes, size);
+#else
+    return ~updatePortable(~crc, bytes, size);
+#endif
+}
+
+auto Crc32c::computePortable(const void* data, std::size_t size, Value crc) noexcept -> Value
+{
+    return ~updatePortable(~crc, static_cast<const unsigned char*>(data), size);
+}
+
+auto Crc32c::accelerated() noexcept -> bool
+{
+#if defined(ISML_CRC32C_X86)
+    return update() != updatePortable;
+#elif defined(ISML_CRC32C_ARM)
+    return true;
+#else
+    return false;
+#endif
+}
+
+} // namespace isml
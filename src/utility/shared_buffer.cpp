@@ -0,0 +1,155 @@
+/**
+ * @file    shared_buffer.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#include <isml/utility/shared_buffer.hpp>
+
+#include <cstring>
+#include <functional>
+#include <new>
+#include <utility>
+
+namespace isml {
+
+/**
+ * @brief   Header placed at the beginning of the memory of the block and
+ *          followed by the bytes. A pooled block owns the pool buffer it is
+ *          placed in.
+ */
+
+struct SharedBuffer::Block
+{
+    std::atomic<std::size_t>    references { 1U };
+    std::shared_ptr<BufferPool> pool       {};
+    BufferPool::Buffer          buffer     {};
+    std::size_t                 size       {};
+
+    auto bytes() noexcept -> char*
+    {
+        return reinterpret_cast<char*>(this + 1);
+    }
+
+    static auto release(Block* block) noexcept -> void
+    {
+        if (!block or block->references.fetch_sub(1U, std::memory_order_acq_rel) != 1U)
+            return;
+
+        // The buffer is moved out before the header placed in it is destroyed
+        auto pool = std::move(block->pool);
+        auto buffer = std::move(block->buffer);
+        block->~Block();
+
+        if (pool)
+            pool->release(std::move(buffer));
+        else
+            ::operator delete(block);
+    }
+};
+
+SharedBuffer::SharedBuffer(Block* block) noexcept
+    : m_block(block)
+{}
+
+SharedBuffer::SharedBuffer(const SharedBuffer& other) noexcept
+    : m_block(other.m_block)
+{
+    if (m_block)
+        m_block->references.fetch_add(1U, std::memory_order_relaxed);
+}
+
+SharedBuffer::SharedBuffer(SharedBuffer&& other) noexcept
+    : m_block(std::exchange(other.m_block, nullptr))
+{}
+
+SharedBuffer::~SharedBuffer()
+{
+    Block::release(m_block);
+}
+
+auto SharedBuffer::operator=(const SharedBuffer& other) noexcept -> SharedBuffer&
+{
+    if (other.m_block)
+        other.m_block->references.fetch_add(1U, std::memory_order_relaxed);
+
+    Block::release(std::exchange(m_block, other.m_block));
+    return *this;
+}
+
+auto SharedBuffer::operator=(SharedBuffer&& other) noexcept -> SharedBuffer&
+{
+    if (this != &other)
+        Block::release(std::exchange(m_block, std::exchange(other.m_block, nullptr)));
+
+    return *this;
+}
+
+auto SharedBuffer::create(const std::shared_ptr<BufferPool>& pool, std::size_t size) -> SharedBuffer
+{
+    if (!pool)
+    {
+        auto* memory = ::operator new(sizeof(Block) + size);
+        return SharedBuffer { new (memory) Block { .size = size } };
+    }
+
+    auto buffer = pool->acquire(sizeof(Block) + size);
+    auto* memory = buffer.data();
+    return SharedBuffer { new (memory) Block { .pool = pool, .buffer = std::move(buffer), .size = size } };
+}
+
+auto SharedBuffer::copy(const std::shared_ptr<BufferPool>& pool, std::string_view bytes) -> SharedBuffer
+{
+    auto buffer = create(pool, bytes.size());
+    if (!bytes.empty())
+        std::memcpy(buffer.data(), bytes.data(), bytes.size());
+    return buffer;
+}
+
+auto SharedBuffer::data() noexcept -> char*
+{
+    return m_block ? m_block->bytes() : nullptr;
+}
+
+auto SharedBuffer::data() const noexcept -> const char*
+{
+    return m_block ? m_block->bytes() : nullptr;
+}
+
+auto SharedBuffer::size() const noexcept -> std::size_t
+{
+    return m_block ? m_block->size : 0U;
+}
+
+auto SharedBuffer::view() const noexcept -> std::string_view
+{
+    return { data(), size() };
+}
+
+auto SharedBuffer::contains(std::string_view bytes) const noexcept -> bool
+{
+    if (!m_block)
+        return false;
+
+    // Pointers to unrelated objects are compared with the total order
+    const std::less_equal<const char*> not_after;
+    const auto* begin = m_block->bytes();
+    return not_after(begin, bytes.data()) and not_after(bytes.data() + bytes.size(), begin + m_block->size);
+}
+
+auto SharedBuffer::references() const noexcept -> std::size_t
+{
+    return m_block ? m_block->references.load(std::memory_order_relaxed) : 0U;
+}
+
+auto SharedBuffer::reset() noexcept -> void
+{
+    Block::release(std::exchange(m_block, nullptr));
+}
+
+SharedBuffer::operator bool() const noexcept
+{
+    return m_block != nullptr;
+}
+
+} // namespace isml
@@ -4,7 +4,14 @@
  * @date    19.04.2020
  */
 
-#include <sstream>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <string_view>
+#include <utility>
 
 ISML_DISABLE_WARNINGS_PUSH
 #   include <gtest/gtest.h>
@@ -13,6 +20,10 @@ ISML_DISABLE_WARNINGS_POP
 #include <isml/serialization/serializers/composite_serializer.hpp>
 #include <isml/serialization/serializers/binary_serializer.hpp>
 
+#include <isml/exceptions.hpp>
+
+#include <isml/base/borrowed.hpp>
+
 #include <isml/message/message.hpp>
 #include <isml/message/message_factory.hpp>
 
@@ -22,7 +33,38 @@ using namespace isml;
 
 using FieldSerializer = CompositeSerializer<BinarySerializer>;
 
-namespace { enum TestMessageType : MessageType { A, B }; }
+namespace {
+
+enum TestMessageType : MessageType { A, B };
+
+/// Number of live blocks allocated by the replaceable operator new.
+std::atomic<std::ptrdiff_t> live_allocations { 0 };
+
+} // namespace
+
+auto operator new(std::size_t size) -> void*
+{
+    if (auto* memory = std::malloc(size ? size : 1U))
+    {
+        live_allocations.fetch_add(1, std::memory_order_relaxed);
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+auto operator delete(void* memory) noexcept -> void
+{
+    if (memory)
+    {
+        live_allocations.fetch_sub(1, std::memory_order_relaxed);
+        std::free(memory);
+    }
+}
+
+auto operator delete(void* memory, std::size_t) noexcept -> void
+{
+    operator delete(memory);
+}
 
 TEST(MessageTests, Serialization)
 {
@@ -35,19 +77,477 @@ TEST(MessageTests, Serialization)
                       .registerField<FieldSerializer, int>("b");
         });
 
-    std::stringstream ss;
+    BinaryWriter writer;
 
     Session::Ptr session { new FakeSession() };
 
-    auto context = SerializationContext::create<BinarySerializer>(ss);
+    auto output = SerializationContext::create<BinarySerializer>(writer);
     auto msg1 = factory.createMessage(TestMessageType::A, *session);
     msg1->field<int>("a") = 10;
     msg1->field<int>("a") = 20;
-    msg1->serialize(context);
+    msg1->serialize(output);
 
+    BinaryReader reader { writer.view() };
+    auto input = SerializationContext::create<BinarySerializer>(reader);
     auto msg2 = factory.createMessage(TestMessageType::A, *session);
-    msg2->deserialize(context);
+    msg2->deserialize(input);
 
     ASSERT_EQ(msg1->field<int>("a"), msg2->field<int>("a"));
     ASSERT_EQ(msg1->field<int>("b"), msg2->field<int>("b"));
 }
+
+TEST(MessageTests, SparseSerialization)
+{
+    MessageFactory factory;
+    factory.addDescriptor(TestMessageType::B, [](MessageDescriptor& descriptor)
+        {
+            for (int i = 0; i < 10; ++i)
+                descriptor.registerField<FieldSerializer, int>("f" + std::to_string(i));
+        });
+
+    Session::Ptr session { new FakeSession() };
+
+    auto msg1 = factory.createMessage(TestMessageType::B, *session);
+    msg1->field<int>("f1") = 10;
+    msg1->field<int>("f9") = 90;
+
+    // Two bytes of the bitmap and two fields
+    ASSERT_EQ(msg1->sparseSerializedSize(), 2U + 2U * sizeof(int));
+
+    BinaryWriter writer;
+    auto output = SerializationContext::create<BinarySerializer>(writer);
+    msg1->serializeSparse(output);
+    ASSERT_EQ(writer.size(), msg1->sparseSerializedSize());
+    ASSERT_EQ(writer.view().substr(0U, 2U), std::string_view("\x02\x02", 2U));
+
+    // Omitted fields are reset
+    auto msg2 = factory.createMessage(TestMessageType::B, *session);
+    msg2->field<int>("f0") = 5;
+
+    BinaryReader reader { writer.view() };
+    auto input = SerializationContext::create<BinarySerializer>(reader);
+    msg2->deserializeSparse(input);
+
+    ASSERT_EQ(msg2->field<int>("f0").get(), 0);
+    ASSERT_EQ(msg2->field<int>("f1").get(), 10);
+    ASSERT_EQ(msg2->field<int>("f9").get(), 90);
+    ASSERT_EQ(reader.remaining(), 0U);
+
+    // Bits beyond the last field
+    const std::string_view malformed { "\x00\x04", 2U };
+    BinaryReader malformed_reader { malformed };
+    auto malformed_input = SerializationContext::create<BinarySerializer>(malformed_reader);
+    ASSERT_THROW(msg2->deserializeSparse(malformed_input), IOException);
+}
+
+TEST(MessageTests, DeltaSerialization)
+{
+    MessageFactory factory;
+    factory.addDescriptor(TestMessageType::A, [](MessageDescriptor& descriptor)
+        {
+            descriptor.registerField<FieldSerializer, int>("a")
+                      .registerField<FieldSerializer, std::string>("b");
+        });
+
+    Session::Ptr session { new FakeSession() };
+
+    auto base = factory.createMessage(TestMessageType::A, *session);
+    base->field<int>("a") = 1;
+    base->field<std::string>("b") = std::string("unchanged");
+
+    auto msg = base->clone();
+    msg->field<int>("a") = 2;
+
+    // The bitmap and the changed field
+    ASSERT_EQ(msg->deltaSerializedSize(*base), 1U + sizeof(int));
+
+    BinaryWriter writer;
+    auto output = SerializationContext::create<BinarySerializer>(writer);
+    msg->serializeDelta(output, *base);
+    ASSERT_EQ(writer.size(), msg->deltaSerializedSize(*base));
+
+    // The changes are applied to the receiver's copy of the base
+    auto received = base->clone();
+    BinaryReader reader { writer.view() };
+    auto input = SerializationContext::create<BinarySerializer>(reader);
+    received->deserializeDelta(input);
+
+    ASSERT_EQ(received->field<int>("a").get(), 2);
+    ASSERT_EQ(received->field<std::string>("b").get(), "unchanged");
+    ASSERT_EQ(reader.remaining(), 0U);
+}
+
+TEST(MessageTests, FixedLayoutSerialization)
+{
+    using Samples = std::array<std::uint16_t, 3>;
+
+    MessageFactory factory;
+    factory.addDescriptor(TestMessageType::A, [](MessageDescriptor& descriptor)
+        {
+            descriptor.registerField<FieldSerializer, int>("a")
+                      .registerField<FieldSerializer, bool>("b")
+                      .registerField<FieldSerializer, double>("c")
+                      .registerField<FieldSerializer, Samples>("d");
+        });
+
+    Session::Ptr session { new FakeSession() };
+
+    auto msg = factory.createMessage(TestMessageType::A, *session);
+    msg->field<int>("a") = -7;
+    msg->field<bool>("b") = true;
+    msg->field<double>("c") = 2.5;
+    msg->field<Samples>("d") = Samples { 1U, 0x0203U, 0xFFFFU };
+
+    // The values are copied as the serializers of the fields write them
+    BinaryWriter expected;
+    auto expected_output = SerializationContext::create<BinarySerializer>(expected);
+    binary::serialize(expected_output, -7);
+    binary::serialize(expected_output, true);
+    binary::serialize(expected_output, 2.5);
+    binary::serialize(expected_output, Samples { 1U, 0x0203U, 0xFFFFU });
+
+    BinaryWriter writer;
+    auto output = SerializationContext::create<BinarySerializer>(writer);
+    msg->serialize(output);
+    ASSERT_EQ(writer.view(), expected.view());
+    ASSERT_EQ(msg->serializedSize(), expected.size());
+
+    auto received = factory.createMessage(TestMessageType::A, *session);
+    BinaryReader reader { writer.view() };
+    auto input = SerializationContext::create<BinarySerializer>(reader);
+    received->deserialize(input);
+    ASSERT_EQ(reader.remaining(), 0U);
+    ASSERT_EQ(received->field<int>("a").get(), -7);
+    ASSERT_TRUE(received->field<bool>("b").get());
+    ASSERT_EQ(received->field<double>("c").get(), 2.5);
+    ASSERT_EQ(received->field<Samples>("d").get(), (Samples { 1U, 0x0203U, 0xFFFFU }));
+
+    // The whole message is checked before a value is changed
+    BinaryReader truncated_reader { writer.view().substr(0U, writer.size() - 1U) };
+    auto truncated_input = SerializationContext::create<BinarySerializer>(truncated_reader);
+    ASSERT_THROW(received->deserialize(truncated_input), IOException);
+    ASSERT_EQ(received->field<int>("a").get(), -7);
+
+    // The element count of the array follows "a", "b" and "c"
+    std::string miscounted { writer.view() };
+    miscounted[sizeof(int) + sizeof(bool) + sizeof(double)] = '\x04';
+    BinaryReader miscounted_reader { std::string_view { miscounted } };
+    auto miscounted_input = SerializationContext::create<BinarySerializer>(miscounted_reader);
+    ASSERT_THROW(received->deserialize(miscounted_input), IOException);
+    ASSERT_EQ(received->field<int>("a").get(), -7);
+    ASSERT_EQ(received->field<Samples>("d").get(), (Samples { 1U, 0x0203U, 0xFFFFU }));
+}
+
+TEST(MessageTests, IndexedSerialization)
+{
+    MessageFactory factory;
+    factory.addDescriptor(TestMessageType::A, [](MessageDescriptor& descriptor)
+        {
+            descriptor.registerField<FieldSerializer, int>("a")
+                      .registerField<FieldSerializer, std::string>("b");
+        });
+
+    Session::Ptr session { new FakeSession() };
+
+    auto msg = factory.createMessage(TestMessageType::A, *session);
+    msg->field<int>("a") = 1;
+    msg->field<std::string>("b") = std::string("lazy");
+
+    // The table of the field end offsets and the fields
+    ASSERT_EQ(msg->indexedSerializedSize(), 2U * 4U + sizeof(int) + 2U + 4U);
+
+    BinaryWriter writer;
+    auto output = SerializationContext::create<BinarySerializer>(writer);
+    msg->serializeIndexed(output);
+    ASSERT_EQ(writer.size(), msg->indexedSerializedSize());
+    ASSERT_EQ(writer.view().substr(0U, 8U), std::string_view("\x04\x00\x00\x00\x0A\x00\x00\x00", 8U));
+    const std::string frame { writer.view() };
+
+    // Fields are decoded on access, a malformed one fails only when accessed
+    std::string malformed = frame;
+    malformed[12] = '\xFF';
+    {
+        auto received = factory.createMessage(TestMessageType::A, *session);
+        BinaryReader reader { std::string_view { malformed } };
+        auto input = SerializationContext::create<BinarySerializer>(reader);
+        received->deserializeIndexed(input);
+        ASSERT_EQ(reader.remaining(), 0U);
+
+        ASSERT_EQ(std::as_const(*received).field<int>("a").get(), 1);
+        ASSERT_THROW(std::as_const(*received).field<std::string>("b"), IOException);
+    }
+
+    auto received = factory.createMessage(TestMessageType::A, *session);
+    BinaryReader reader { std::string_view { frame } };
+    auto input = SerializationContext::create<BinarySerializer>(reader);
+    received->deserializeIndexed(input);
+
+    // Unmodified messages are written by copying the received bytes
+    const auto clone = received->clone();
+    ASSERT_EQ(std::as_const(*received).field<std::string>("b").get(), "lazy");
+    ASSERT_EQ(clone->field<std::string>("b").get(), "lazy");
+    {
+        BinaryWriter forwarded;
+        auto forwarded_output = SerializationContext::create<BinarySerializer>(forwarded);
+        received->serializeIndexed(forwarded_output);
+        ASSERT_EQ(forwarded.view(), frame);
+
+        forwarded.clear();
+        received->serialize(forwarded_output);
+        ASSERT_EQ(forwarded.view(), frame.substr(8U));
+        ASSERT_EQ(received->serializedSize(), frame.size() - 8U);
+    }
+
+    // A modified field is encoded again, the others are copied
+    received->field<int>("a") = 3;
+
+    BinaryWriter modified;
+    auto modified_output = SerializationContext::create<BinarySerializer>(modified);
+    received->serializeIndexed(modified_output);
+    ASSERT_EQ(modified.size(), received->indexedSerializedSize());
+
+    auto decoded = factory.createMessage(TestMessageType::A, *session);
+    BinaryReader modified_reader { modified.view() };
+    auto modified_input = SerializationContext::create<BinarySerializer>(modified_reader);
+    decoded->deserializeIndexed(modified_input);
+    ASSERT_EQ(decoded->field<int>("a").get(), 3);
+    ASSERT_EQ(decoded->field<std::string>("b").get(), "lazy");
+    ASSERT_EQ(std::as_const(*clone).field<int>("a").get(), 1);
+
+    // Decreasing offsets
+    const std::string_view invalid_table { "\x04\x00\x00\x00\x02\x00\x00\x00", 8U };
+    BinaryReader invalid_reader { invalid_table };
+    auto invalid_input = SerializationContext::create<BinarySerializer>(invalid_reader);
+    ASSERT_THROW(decoded->deserializeIndexed(invalid_input), IOException);
+}
+
+TEST(MessageTests, IndexedSerializationFreesRetainedFields)
+{
+    MessageFactory factory;
+    factory.addDescriptor(TestMessageType::A, [](MessageDescriptor& descriptor)
+        {
+            descriptor.registerField<FieldSerializer, int>("a")
+                      .registerField<FieldSerializer, std::string>("b");
+        });
+
+    Session::Ptr session { new FakeSession() };
+
+    auto msg = factory.createMessage(TestMessageType::A, *session);
+    msg->field<std::string>("b") = std::string("retained");
+
+    BinaryWriter writer;
+    auto output = SerializationContext::create<BinarySerializer>(writer);
+    msg->serializeIndexed(output);
+    const std::string frame { writer.view() };
+
+    auto received = factory.createMessage(TestMessageType::A, *session);
+    const auto read = [&]
+        {
+            BinaryReader reader { std::string_view { frame } };
+            auto input = SerializationContext::create<BinarySerializer>(reader);
+            received->deserializeIndexed(input);
+        };
+
+    // A read releases the fields retained by the previous one
+    read();
+    const auto retained = live_allocations.load();
+    read();
+    read();
+    ASSERT_EQ(live_allocations.load(), retained);
+}
+
+TEST(MessageTests, CloneFields)
+{
+    MessageFactory factory;
+    factory.addDescriptor(TestMessageType::A, [](MessageDescriptor& descriptor)
+        {
+            descriptor.registerField<FieldSerializer, int>("a")
+                      .registerField<FieldSerializer, std::string>("b");
+        });
+
+    Session::Ptr session { new FakeSession() };
+
+    auto msg = factory.createMessage(TestMessageType::A, *session);
+    ASSERT_TRUE(msg->hasField("b"));
+    ASSERT_FALSE(msg->hasField("c"));
+    ASSERT_EQ(msg->field<std::string>("b").name(), "b");
+    ASSERT_THROW(msg->field<int>("b"), FieldDoesNotExistException);
+
+    msg->field<int>("a") = 1;
+    msg->field<std::string>("b") = std::string(64, 'x');
+
+    auto clone = msg->clone();
+    clone->field<std::string>("b").ref().resize(8U);
+
+    ASSERT_EQ(clone->field<int>("a").get(), 1);
+    ASSERT_EQ(clone->field<std::string>("b").get(), std::string(8, 'x'));
+    ASSERT_EQ(msg->field<std::string>("b").get(), std::string(64, 'x'));
+}
+
+TEST(MessageTests, FieldHandles)
+{
+    MessageFactory factory;
+    factory.addDescriptor(TestMessageType::A, [](MessageDescriptor& descriptor)
+        {
+            descriptor.registerField<FieldSerializer, int>("a")
+                      .registerField<FieldSerializer, std::string>("b");
+        });
+    factory.addDescriptor(TestMessageType::B, [](MessageDescriptor& descriptor)
+        {
+            descriptor.registerField<FieldSerializer, int>("a");
+        });
+
+    const auto a = factory.fieldHandle<int>(TestMessageType::A, "a");
+    const auto b = factory.fieldHandle<std::string>(TestMessageType::A, "b");
+
+    ASSERT_THROW(factory.fieldHandle<int>(TestMessageType::A, "b"), InvalidCastException);
+    ASSERT_THROW(factory.fieldHandle<int>(TestMessageType::A, "c"), InvalidArgumentException);
+    ASSERT_THROW(factory.fieldHandle<int>(TestMessageType::B + 1, "a"), UnknownMessageTypeException);
+
+    Session::Ptr session { new FakeSession() };
+
+    auto msg = factory.createMessage(TestMessageType::A, *session);
+    msg->field(a) = 7;
+    msg->field(b) = std::string("handle");
+
+    ASSERT_EQ(msg->field<int>("a").get(), 7);
+    ASSERT_EQ(msg->field(b).get(), "handle");
+
+    // A handle of another message type
+    auto other = factory.createMessage(TestMessageType::B, *session);
+    ASSERT_THROW(other->field(a), FieldDoesNotExistException);
+
+    // A handle of a layout of the type having another value type at the index
+    MessageFactory swapped;
+    swapped.addDescriptor(TestMessageType::A, [](MessageDescriptor& descriptor)
+        {
+            descriptor.registerField<FieldSerializer, std::string>("b")
+                      .registerField<FieldSerializer, int>("a");
+        });
+    auto foreign = swapped.createMessage(TestMessageType::A, *session);
+    ASSERT_THROW(foreign->field(a), FieldDoesNotExistException);
+    ASSERT_THROW(std::as_const(*foreign).field(b), FieldDoesNotExistException);
+
+    // A handle obtained before a field was registered stays valid
+    MessageDescriptor descriptor { TestMessageType::B };
+    descriptor.registerField<FieldSerializer, int>("a");
+    const auto early = descriptor.fieldHandle<int>("a");
+    descriptor.registerField<FieldSerializer, std::string>("c");
+    Message late { descriptor, session };
+    late.field(early) = 3;
+    ASSERT_EQ(late.field<int>("a").get(), 3);
+}
+
+TEST(MessageTests, CopyOnWrite)
+{
+    MessageFactory factory;
+    factory.addDescriptor(TestMessageType::A, [](MessageDescriptor& descriptor)
+        {
+            descriptor.registerField<FieldSerializer, int>("a")
+                      .registerField<FieldSerializer, std::string>("b");
+        });
+
+    Session::Ptr session { new FakeSession() };
+
+    auto msg = factory.createMessage(TestMessageType::A, *session);
+    msg->field<int>("a") = 1;
+    msg->field<std::string>("b") = std::string("shared");
+
+    // Clones share the fields while they are read
+    auto first = msg->clone();
+    auto second = msg->clone();
+    const auto& shared = std::as_const(*msg).field<std::string>("b").cref();
+    ASSERT_EQ(&std::as_const(*first).field<std::string>("b").cref(), &shared);
+    ASSERT_EQ(&std::as_const(*second).field<std::string>("b").cref(), &shared);
+
+    BinaryWriter writer;
+    auto output = SerializationContext::create<BinarySerializer>(writer);
+    std::as_const(*first).serialize(output);
+    ASSERT_EQ(&std::as_const(*first).field<std::string>("b").cref(), &shared);
+
+    // The first modification copies the fields
+    first->field<int>("a") = 2;
+    ASSERT_NE(&std::as_const(*first).field<std::string>("b").cref(), &shared);
+    ASSERT_EQ(first->field<std::string>("b").get(), "shared");
+    ASSERT_EQ(std::as_const(*msg).field<int>("a").get(), 1);
+    ASSERT_EQ(std::as_const(*second).field<int>("a").get(), 1);
+
+    // Deserialization too
+    BinaryReader reader { writer.view() };
+    auto input = SerializationContext::create<BinarySerializer>(reader);
+    second->deserialize(input);
+    ASSERT_NE(&std::as_const(*second).field<std::string>("b").cref(), &shared);
+
+    // The last owner modifies the fields in place
+    msg->field<std::string>("b") = std::string("owned");
+    ASSERT_EQ(&std::as_const(*msg).field<std::string>("b").cref(), &shared);
+    ASSERT_EQ(second->field<std::string>("b").get(), "shared");
+}
+
+TEST(MessageTests, BorrowedFields)
+{
+    MessageFactory factory;
+    factory.addDescriptor(TestMessageType::A, [](MessageDescriptor& descriptor)
+        {
+            descriptor.registerField<FieldSerializer, int>("a")
+                      .registerField<FieldSerializer, std::string>("b");
+        });
+    factory.addDescriptor(TestMessageType::B, [](MessageDescriptor& descriptor)
+        {
+            descriptor.registerField<FieldSerializer, int>("a")
+                      .registerField<FieldSerializer, BorrowedString>("b");
+        });
+
+    Session::Ptr session { new FakeSession() };
+
+    auto msg = factory.createMessage(TestMessageType::A, *session);
+    msg->field<int>("a") = 1;
+    msg->field<std::string>("b") = std::string("payload");
+
+    BinaryWriter writer;
+    auto output = SerializationContext::create<BinarySerializer>(writer);
+    msg->serialize(output);
+    const auto plain_size = writer.size();
+    msg->serializeIndexed(output);
+
+    auto frame = SharedBuffer::copy(nullptr, writer.view());
+    auto received = factory.createMessage(TestMessageType::B, *session);
+    auto indexed = factory.createMessage(TestMessageType::B, *session);
+    {
+        BinaryReader reader { frame };
+        auto input = SerializationContext::create<BinarySerializer>(reader);
+        received->deserialize(input);
+        indexed->deserializeIndexed(input);
+        ASSERT_EQ(reader.remaining(), 0U);
+    }
+
+    // The fields refer to the frame, which is kept alive by the messages
+    const auto& borrowed = std::as_const(*received).field<BorrowedString>("b").get();
+    const auto& lazy = std::as_const(*indexed).field<BorrowedString>("b").get();
+    ASSERT_TRUE(frame.contains(borrowed.view()));
+    ASSERT_TRUE(frame.contains(lazy.view()));
+    ASSERT_GE(lazy.view().data(), frame.data() + plain_size);
+    frame.reset();
+
+    ASSERT_EQ(borrowed.view(), "payload");
+    ASSERT_EQ(lazy.materialize(), "payload");
+    ASSERT_EQ(received->serializedSize(), msg->serializedSize());
+
+    // The fields of the clone keep referring to the frame
+    const auto clone = received->clone();
+    ASSERT_EQ(std::as_const(*clone).field<BorrowedString>("b").get().data(), borrowed.data());
+    received.reset();
+    ASSERT_EQ(clone->field<BorrowedString>("b").get().view(), "payload");
+
+    // A value set from a plain view is copied into the clone, which may
+    // outlive the bytes of the caller
+    std::string source = "caller";
+    auto unowned = factory.createMessage(TestMessageType::B, *session);
+    unowned->field<BorrowedString>("b") = BorrowedString { source };
+    const auto owned = unowned->clone();
+    ASSERT_TRUE(std::as_const(*unowned).field<BorrowedString>("b").get().unowned());
+    ASSERT_FALSE(std::as_const(*owned).field<BorrowedString>("b").get().unowned());
+    source.replace(0U, source.size(), "callee");
+    ASSERT_EQ(std::as_const(*unowned).field<BorrowedString>("b").get().view(), "callee");
+    ASSERT_EQ(std::as_const(*owned).field<BorrowedString>("b").get().view(), "caller");
+}
@@ -4,7 +4,10 @@
  * @date    20.03.2020
  */
 
+#include <array>
+#include <cstdint>
 #include <memory>
+#include <string>
 
 ISML_DISABLE_WARNINGS_PUSH
 #   include <gtest/gtest.h>
@@ -13,13 +16,20 @@ ISML_DISABLE_WARNINGS_POP
 #include <isml/serialization/serializers/composite_serializer.hpp>
 #include <isml/serialization/serializers/binary_serializer.hpp>
 
+#include <isml/exceptions.hpp>
+
 #include <isml/message/message_descriptor.hpp>
 
 using namespace isml;
 
 using FieldSerializer = CompositeSerializer<BinarySerializer>;
 
-namespace { enum TestMessageType : MessageType { A, B }; }
+namespace {
+
+enum TestMessageType : MessageType { A, B };
+enum class Mode : std::uint8_t { Idle, Active };
+
+} // namespace
 
 TEST(MessageDescriptorTests, AddField)
 {
@@ -39,3 +49,58 @@ TEST(MessageDescriptorTests, MoveDescriptor)
     descriptor.registerField<FieldSerializer, int>(name);
     MessageDescriptor descriptor2 { std::move(descriptor) };
 }
+
+TEST(MessageDescriptorTests, FieldLayout)
+{
+    MessageDescriptor descriptor { TestMessageType::A };
+    descriptor.registerField<FieldSerializer, std::uint8_t>("a")
+              .registerField<FieldSerializer, double>("b")
+              .registerField<FieldSerializer, std::string>("c");
+
+    const auto& layout = *descriptor.layout();
+    ASSERT_EQ(layout.size(), 3U);
+    ASSERT_EQ(*layout.indexOf("c"), 2U);
+    ASSERT_TRUE(layout.indexOf("d").isNone());
+
+    // The fields follow the table of pointers and are aligned
+    ASSERT_GE(layout.offset(0U), 3U * sizeof(void*));
+    for (std::size_t index = 0U; index < layout.size(); ++index)
+        ASSERT_EQ(layout.offset(index) % layout.descriptors()[index]->fieldAlignment(), 0U);
+    ASSERT_EQ(layout.storageSize() % layout.storageAlignment(), 0U);
+
+    // Copies share the layout, a registration creates a new one
+    MessageDescriptor copy { descriptor };
+    ASSERT_EQ(copy.layout(), descriptor.layout());
+
+    copy.registerField<FieldSerializer, int>("d");
+    ASSERT_NE(copy.layout(), descriptor.layout());
+    ASSERT_EQ(descriptor.layout()->size(), 3U);
+
+    ASSERT_THROW((copy.registerField<FieldSerializer, int>("a")), InvalidArgumentException);
+}
+
+TEST(MessageDescriptorTests, FixedLayout)
+{
+    MessageDescriptor descriptor { TestMessageType::A };
+    ASSERT_TRUE(descriptor.fixedSerializedSize().isNone());
+
+    descriptor.registerField<FieldSerializer, int>("a")
+              .registerField<FieldSerializer, double>("b")
+              .registerField<FieldSerializer, Mode>("c")
+              .registerField<FieldSerializer, std::array<std::uint16_t, 3>>("d");
+
+    // The array is preceded by the element count
+    const auto& layout = *descriptor.layout();
+    ASSERT_TRUE(layout.fixed());
+    ASSERT_EQ(*descriptor.fixedSerializedSize(), sizeof(int) + sizeof(double) + 1U + 2U + 3U * 2U);
+    ASSERT_EQ(layout.fixedFields().size(), 4U);
+    ASSERT_EQ(layout.fixedFields()[3].wire_offset, sizeof(int) + sizeof(double) + 1U + 2U);
+    ASSERT_TRUE(layout.fixedFields()[3].counted);
+
+    // A variable-size field makes the layout generic
+    MessageDescriptor generic { descriptor };
+    generic.registerField<FieldSerializer, std::string>("e");
+    ASSERT_FALSE(generic.layout()->fixed());
+    ASSERT_TRUE(generic.fixedSerializedSize().isNone());
+    ASSERT_TRUE(descriptor.layout()->fixed());
+}
@@ -4,6 +4,14 @@
  * @date    20.03.2020
  */
 
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
 ISML_DISABLE_WARNINGS_PUSH
 #   include <gtest/gtest.h>
 ISML_DISABLE_WARNINGS_POP
@@ -11,8 +19,14 @@ ISML_DISABLE_WARNINGS_POP
 #include <isml/serialization/serializers/composite_serializer.hpp>
 #include <isml/serialization/serializers/binary_serializer.hpp>
 
+#include <isml/base/borrowed.hpp>
+
+#include <isml/message/exceptions.hpp>
+#include <isml/message/field/type_signature.hpp>
 #include <isml/message/message_factory.hpp>
 
+#include <isml/session/fake_session.hpp>
+
 using namespace isml;
 
 using FieldSerializer = CompositeSerializer<BinarySerializer>;
@@ -30,3 +44,172 @@ TEST(MessageFactoryTests, AddMessageDescriptor)
 
     ASSERT_TRUE(factory.hasDescriptor(TestMessageType::A));
 }
+
+TEST(MessageFactoryTests, PoolMessages)
+{
+    MessageFactory factory;
+    factory.addDescriptor(TestMessageType::A, [](MessageDescriptor& descriptor)
+        {
+            descriptor.registerField<FieldSerializer, int>("a")
+                      .registerField<FieldSerializer, std::string>("b");
+        });
+
+    ASSERT_TRUE(factory.pool(TestMessageType::A).isNone());
+    factory.setPoolCapacity(1U);
+    auto& pool = factory.pool(TestMessageType::A).value();
+
+    Session::Ptr session { new FakeSession() };
+
+    auto msg = factory.createMessage(TestMessageType::A, *session);
+    msg->field<int>("a") = 1;
+    msg->field<std::string>("b") = std::string("pooled");
+    msg->setStreamId(3U);
+
+    const auto* address = msg.get();
+    const auto id = msg->id();
+    msg.reset();
+
+    // The same message holding the default values
+    msg = factory.createMessage(TestMessageType::A, *session);
+    ASSERT_EQ(msg.get(), address);
+    ASSERT_NE(msg->id(), id);
+    ASSERT_EQ(msg->session(), session);
+    ASSERT_EQ(msg->field<int>("a").get(), 0);
+    ASSERT_EQ(msg->field<std::string>("b").get(), "");
+    ASSERT_EQ(msg->streamId(), 0U);
+    ASSERT_EQ(pool.statistics().hits, 1U);
+    ASSERT_EQ(pool.statistics().misses, 1U);
+
+    // Clones aren't pooled, messages beyond the capacity are freed
+    auto clone = msg->clone();
+    auto other = factory.createMessage(TestMessageType::A, *session);
+    msg.reset();
+    other.reset();
+    clone.reset();
+    ASSERT_EQ(pool.statistics().misses, 2U);
+    ASSERT_EQ(pool.statistics().discarded, 1U);
+
+    // Released on another thread, the message goes to its free list
+    msg = factory.createMessage(TestMessageType::A, *session);
+    std::thread { [message = std::move(msg)]() mutable { message.reset(); } }.join();
+    ASSERT_EQ(pool.statistics().hits, 2U);
+
+    pool.trim();
+}
+
+TEST(MessageFactoryTests, FreezeRegistry)
+{
+    constexpr MessageType late_type = 1000U;
+
+    MessageFactory factory;
+    factory.addDescriptor(TestMessageType::A, [](MessageDescriptor& descriptor)
+        {
+            descriptor.registerField<FieldSerializer, int>("a");
+        });
+
+    ASSERT_FALSE(factory.frozen());
+    factory.freeze();
+    ASSERT_TRUE(factory.frozen());
+
+    Session::Ptr session { new FakeSession() };
+
+    ASSERT_TRUE(factory.hasDescriptor(TestMessageType::A));
+    ASSERT_FALSE(factory.hasDescriptor(TestMessageType::B));
+    ASSERT_FALSE(factory.hasDescriptor(late_type));
+    ASSERT_TRUE(factory.tryCreateMessage(TestMessageType::A, *session));
+    ASSERT_FALSE(factory.tryCreateMessage(late_type, *session));
+    ASSERT_THROW(factory.createMessage(late_type, *session), UnknownMessageTypeException);
+
+    // Messages are created while a type is registered
+    std::atomic<bool> stop { false };
+    std::thread reader { [&]
+        {
+            while (!stop)
+                ASSERT_EQ(factory.createMessage(TestMessageType::A, *session)->type(), TestMessageType::A);
+        } };
+
+    factory.addDescriptor(late_type, [](MessageDescriptor& descriptor)
+        {
+            descriptor.registerField<FieldSerializer, std::string>("b");
+        });
+    factory.setPoolCapacity(1U);
+
+    stop = true;
+    reader.join();
+
+    const auto handle = factory.fieldHandle<std::string>(late_type, "b");
+    auto msg = factory.createMessage(late_type, *session);
+    ASSERT_EQ(msg->field(handle).get(), "");
+    ASSERT_TRUE(factory.pool(late_type).isSome());
+    msg.reset();
+    factory.pool(late_type).value().trim();
+
+    // Registering a type keeps the pools of the others, the tables replaced
+    // meanwhile are freed along with the pools only they refer to
+    const auto pooled = factory.pool(late_type).value().weak_from_this();
+    factory.addDescriptor(TestMessageType::B, [](MessageDescriptor& descriptor)
+        {
+            descriptor.registerField<FieldSerializer, int>("a");
+        });
+    factory.setPoolCapacity(1U);
+    ASSERT_EQ(&factory.pool(late_type).value(), pooled.lock().get());
+    factory.setPoolCapacity(2U);
+    ASSERT_TRUE(pooled.expired());
+    ASSERT_EQ(factory.pool(late_type).value().capacity(), 2U);
+
+    // Copies are frozen as well and refer to their own descriptors
+    MessageFactory copy { factory };
+    factory = MessageFactory {};
+    ASSERT_TRUE(copy.frozen());
+    ASSERT_TRUE(copy.hasDescriptor(late_type));
+    ASSERT_FALSE(factory.frozen());
+    ASSERT_FALSE(factory.hasDescriptor(late_type));
+}
+
+TEST(MessageFactoryTests, Fingerprint)
+{
+    const auto fingerprint = [](auto register_fields)
+        {
+            MessageFactory factory;
+            factory.addDescriptor(TestMessageType::A, register_fields);
+            return factory.fingerprint();
+        };
+
+    const auto base = fingerprint([](MessageDescriptor& descriptor)
+        {
+            descriptor.registerField<FieldSerializer, std::int32_t>("a")
+                      .registerField<FieldSerializer, std::string>("b");
+        });
+
+    // The value types are a part of the schema
+    ASSERT_NE(base, fingerprint([](MessageDescriptor& descriptor)
+        {
+            descriptor.registerField<FieldSerializer, std::int64_t>("a")
+                      .registerField<FieldSerializer, std::string>("b");
+        }));
+    ASSERT_NE(base, fingerprint([](MessageDescriptor& descriptor)
+        {
+            descriptor.registerField<FieldSerializer, std::uint32_t>("a")
+                      .registerField<FieldSerializer, std::string>("b");
+        }));
+
+    // Borrowed strings are encoded as the owning ones
+    ASSERT_EQ(base, fingerprint([](MessageDescriptor& descriptor)
+        {
+            descriptor.registerField<FieldSerializer, std::int32_t>("a")
+                      .registerField<FieldSerializer, BorrowedString>("b");
+        }));
+
+    ASSERT_EQ((typeSignature<std::map<std::uint16_t, std::vector<double>>>()), "m(u2,v(f8))");
+    ASSERT_EQ((typeSignature<std::array<std::int8_t, 4>>()), "a4(i1)");
+}
+
+TEST(MessageFactoryTests, RejectReservedMessageType)
+{
+    MessageFactory factory;
+    ASSERT_FALSE(factory.addDescriptor(k_reserved_msg_type, [](MessageDescriptor& descriptor)
+        {
+            descriptor.registerField<FieldSerializer, int>("a");
+        }));
+    ASSERT_FALSE(factory.hasDescriptor(k_reserved_msg_type));
+}
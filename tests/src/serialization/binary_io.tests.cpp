@@ -0,0 +1,220 @@
+/**
+ * @file    binary_io.tests.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#include <array>
+#include <string>
+#include <vector>
+
+ISML_DISABLE_WARNINGS_PUSH
+#   include <gtest/gtest.h>
+ISML_DISABLE_WARNINGS_POP
+
+#include <isml/exceptions.hpp>
+
+#include <isml/base/borrowed.hpp>
+
+#include <isml/serialization/serialization_utility.hpp>
+#include <isml/serialization/serializers/binary_serializer.hpp>
+#include <isml/serialization/string_dictionary.hpp>
+
+#include <isml/utility/shared_buffer.hpp>
+
+using namespace isml;
+
+TEST(BinaryIoTests, RoundTrip)
+{
+    const std::vector<std::uint32_t> numbers { 1U, 2U, 0xDEADBEEFU };
+    const std::string text = "binary";
+
+    BinaryWriter writer;
+    auto output = SerializationContext::create<BinarySerializer>(writer);
+    serialize<BinarySerializer>(output, numbers, "");
+    serialize<BinarySerializer>(output, text, "");
+    ASSERT_EQ(writer.size(), binary::size(numbers) + binary::size(text));
+
+    std::vector<std::uint32_t> numbers_read;
+    std::string text_read;
+
+    BinaryReader reader { writer.view() };
+    auto input = SerializationContext::create<BinarySerializer>(reader);
+    deserialize<BinarySerializer>(input, numbers_read, "");
+    deserialize<BinarySerializer>(input, text_read, "");
+
+    ASSERT_EQ(numbers_read, numbers);
+    ASSERT_EQ(text_read, text);
+    ASSERT_EQ(reader.remaining(), 0U);
+}
+
+TEST(BinaryIoTests, ExternalBufferIsBoundsChecked)
+{
+    std::array<char, 6> buffer {};
+    BinaryWriter writer { std::span(buffer) };
+    auto output = SerializationContext::create<BinarySerializer>(writer);
+
+    serialize<BinarySerializer>(output, std::uint32_t { 0x01020304U }, "");
+    ASSERT_EQ(writer.data(), buffer.data());
+    ASSERT_THROW(serialize<BinarySerializer>(output, std::uint32_t {}, ""), IOException);
+    ASSERT_EQ(writer.size(), 4U);
+}
+
+TEST(BinaryIoTests, ReadingPastEndThrows)
+{
+    const std::array<char, 3> data { 1, 2, 3 };
+    BinaryReader reader { std::span<const char>(data) };
+    auto input = SerializationContext::create<BinarySerializer>(reader);
+
+    std::uint16_t value {};
+    deserialize<BinarySerializer>(input, value, "");
+    ASSERT_THROW(deserialize<BinarySerializer>(input, value, ""), IOException);
+    ASSERT_EQ(reader.take(1U), std::string_view("\x03", 1U));
+}
+
+TEST(BinaryIoTests, ContiguousContainersKeepWireFormat)
+{
+    enum class Level : std::uint16_t { Low = 1, High = 0x0203 };
+
+    const std::vector<std::uint16_t> numbers { 1U, 0x0203U };
+    const std::vector<Level> levels { Level::Low, Level::High };
+    const std::array<float, 2> values { 1.5F, -2.0F };
+    static_assert(BulkBinaryContainer<decltype(numbers)>);
+    static_assert(BulkBinaryContainer<decltype(values)>);
+    static_assert(BulkBinaryContainer<std::string>);
+    static_assert(!BulkBinaryContainer<std::vector<std::string>>);
+
+    BinaryWriter writer;
+    auto output = SerializationContext::create<BinarySerializer>(writer);
+    serialize<BinarySerializer>(output, numbers, "");
+    serialize<BinarySerializer>(output, levels, "");
+    serialize<BinarySerializer>(output, values, "");
+
+    // Little-endian element count followed by little-endian elements
+    ASSERT_EQ(writer.view().substr(0U, 6U), std::string_view("\x02\x00\x01\x00\x03\x02", 6U));
+    ASSERT_EQ(writer.view().substr(6U, 6U), writer.view().substr(0U, 6U));
+    ASSERT_EQ(writer.size(), binary::size(numbers) + binary::size(levels) + binary::size(values));
+
+    std::vector<std::uint16_t> numbers_read;
+    std::vector<Level> levels_read;
+    std::array<float, 2> values_read {};
+
+    BinaryReader reader { writer.view() };
+    auto input = SerializationContext::create<BinarySerializer>(reader);
+    deserialize<BinarySerializer>(input, numbers_read, "");
+    deserialize<BinarySerializer>(input, levels_read, "");
+    deserialize<BinarySerializer>(input, values_read, "");
+
+    ASSERT_EQ(numbers_read, numbers);
+    ASSERT_EQ(levels_read, levels);
+    ASSERT_EQ(values_read, values);
+}
+
+TEST(BinaryIoTests, TruncatedContainerIsRejected)
+{
+    const std::string data { "\xFF\x00\x01\x02", 4U };
+    BinaryReader reader { std::string_view(data) };
+    auto input = SerializationContext::create<BinarySerializer>(reader);
+
+    std::string text;
+    ASSERT_THROW(deserialize<BinarySerializer>(input, text, ""), IOException);
+    ASSERT_TRUE(text.empty());
+}
+
+TEST(BinaryIoTests, ArrayOfOtherSizeIsRejected)
+{
+    BinaryWriter writer;
+    auto output = SerializationContext::create<BinarySerializer>(writer);
+    serialize<BinarySerializer>(output, std::array<std::uint16_t, 3> { 1U, 2U, 3U }, "");
+    serialize<BinarySerializer>(output, std::array<std::string, 1> { "one" }, "");
+
+    BinaryReader reader { writer.view() };
+    auto input = SerializationContext::create<BinarySerializer>(reader);
+
+    std::array<std::uint16_t, 2> numbers {};
+    ASSERT_THROW(deserialize<BinarySerializer>(input, numbers, ""), IOException);
+
+    BinaryReader other_reader { writer.view() };
+    auto other_input = SerializationContext::create<BinarySerializer>(other_reader);
+    std::array<std::uint16_t, 3> exact {};
+    std::array<std::string, 2> texts {};
+    deserialize<BinarySerializer>(other_input, exact, "");
+    ASSERT_EQ(exact, (std::array<std::uint16_t, 3> { 1U, 2U, 3U }));
+    ASSERT_THROW(deserialize<BinarySerializer>(other_input, texts, ""), IOException);
+}
+
+TEST(BinaryIoTests, BorrowedValuesReferToBackingBuffer)
+{
+    const std::string text = "borrowed";
+    const std::vector<std::uint8_t> bytes { 1U, 2U, 3U };
+
+    BinaryWriter writer;
+    auto output = SerializationContext::create<BinarySerializer>(writer);
+    serialize<BinarySerializer>(output, text, "");
+    serialize<BinarySerializer>(output, bytes, "");
+
+    auto pool = std::make_shared<BufferPool>();
+    auto frame = SharedBuffer::copy(pool, writer.view());
+
+    BorrowedString text_read;
+    BorrowedBytes bytes_read;
+    {
+        BinaryReader reader { frame };
+        auto input = SerializationContext::create<BinarySerializer>(reader);
+        deserialize<BinarySerializer>(input, text_read, "");
+        deserialize<BinarySerializer>(input, bytes_read, "");
+        ASSERT_EQ(reader.remaining(), 0U);
+    }
+
+    // Nothing is copied: the values keep the frame alive
+    ASSERT_TRUE(frame.contains(text_read.view()));
+    ASSERT_EQ(frame.references(), 3U);
+    frame.reset();
+
+    ASSERT_EQ(text_read.view(), text);
+    ASSERT_EQ(text_read.materialize(), text);
+    ASSERT_EQ(bytes_read.materialize(), bytes);
+    ASSERT_EQ(binary::size(text_read), binary::size(text));
+
+    // The frame returns to the pool with the last value referring to it
+    text_read = {};
+    bytes_read = {};
+    SharedBuffer::create(pool, writer.size());
+    ASSERT_EQ(pool->hits(), 1U);
+
+    // Borrowed values are written as the owning ones
+    BinaryWriter borrowed_writer;
+    auto borrowed_output = SerializationContext::create<BinarySerializer>(borrowed_writer);
+    serialize<BinarySerializer>(borrowed_output, BorrowedString { text }, "");
+    serialize<BinarySerializer>(borrowed_output, BorrowedBytes { bytes }, "");
+    ASSERT_EQ(borrowed_writer.view(), writer.view());
+}
+
+TEST(BinaryIoTests, BorrowedValuesWithoutBackingBufferAreCopied)
+{
+    StringDictionary sent;
+    StringDictionary received;
+
+    BinaryWriter writer;
+    auto output = SerializationContext::create<BinarySerializer>(writer);
+    output.setDictionary(&sent);
+    serialize<BinarySerializer>(output, std::string("interned"), "");
+    serialize<BinarySerializer>(output, BorrowedString { "interned" }, "");
+
+    BorrowedString definition;
+    BorrowedString reference;
+    {
+        const std::string data { writer.view() };
+        BinaryReader reader { std::string_view(data) };
+        auto input = SerializationContext::create<BinarySerializer>(reader);
+        input.setDictionary(&received);
+        deserialize<BinarySerializer>(input, definition, "");
+        deserialize<BinarySerializer>(input, reference, "");
+        ASSERT_EQ(reader.remaining(), 0U);
+    }
+
+    ASSERT_EQ(definition.view(), "interned");
+    ASSERT_EQ(reference.view(), "interned");
+    ASSERT_EQ(definition.buffer().references(), 1U);
+    ASSERT_EQ(received.at(0U), "interned");
+}
@@ -0,0 +1,135 @@
+/**
+ * @file    compact_binary_serializer.tests.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+ISML_DISABLE_WARNINGS_PUSH
+#   include <gtest/gtest.h>
+ISML_DISABLE_WARNINGS_POP
+
+#include <isml/exceptions.hpp>
+
+#include <isml/serialization/serialization_utility.hpp>
+#include <isml/serialization/serializers/compact_binary_serializer.hpp>
+
+using namespace isml;
+
+namespace {
+
+template<typename T>
+auto roundTrip(const T& value, std::size_t padding = 0U) -> T
+{
+    BinaryWriter writer;
+    auto output = SerializationContext::create<CompactBinarySerializer>(writer);
+    serialize<CompactBinarySerializer>(output, value, "");
+    EXPECT_EQ(writer.size(), compact::size(value));
+
+    // Padding lets the decoder take the single-load path
+    const std::string padding_bytes(padding, '\xFF');
+    writer.write(padding_bytes.data(), padding_bytes.size());
+
+    T result {};
+    BinaryReader reader { writer.view() };
+    auto input = SerializationContext::create<CompactBinarySerializer>(reader);
+    deserialize<CompactBinarySerializer>(input, result, "");
+    EXPECT_EQ(reader.remaining(), padding);
+    return result;
+}
+
+} // namespace
+
+TEST(CompactBinarySerializerTests, Varints)
+{
+    const std::vector<std::uint64_t> values {
+        0U, 1U, 127U, 128U, 300U, 16383U, 16384U,
+        (1ULL << 49U) - 1U, 1ULL << 49U, (1ULL << 56U) - 1U, 1ULL << 56U,
+        std::numeric_limits<std::uint64_t>::max() };
+
+    for (const auto value : values)
+    {
+        ASSERT_EQ(roundTrip(value), value);
+        ASSERT_EQ(roundTrip(value, 8U), value);
+    }
+
+    ASSERT_EQ(compact::size(std::uint32_t { 127U }), 1U);
+    ASSERT_EQ(compact::size(std::uint32_t { 128U }), 2U);
+    ASSERT_EQ(compact::size(std::numeric_limits<std::uint64_t>::max()), CompactBinarySerializerBase::k_max_varint_size);
+}
+
+TEST(CompactBinarySerializerTests, ZigzagIntegers)
+{
+    for (const std::int32_t value : { 0, -1, 1, -64, 64, std::numeric_limits<std::int32_t>::min(),
+                                      std::numeric_limits<std::int32_t>::max() })
+    {
+        ASSERT_EQ(roundTrip(value), value);
+        ASSERT_EQ(roundTrip(value, 8U), value);
+    }
+
+    ASSERT_EQ(compact::size(std::int64_t { -64 }), 1U);
+    ASSERT_EQ(compact::size(std::int64_t { 64 }), 2U);
+    ASSERT_EQ(roundTrip(std::int16_t { -300 }), -300);
+}
+
+TEST(CompactBinarySerializerTests, Containers)
+{
+    const std::vector<std::int32_t> numbers { -1, 0, 1000000 };
+    const std::string text(200U, 'x');
+    const std::map<std::string, std::optional<std::uint16_t>> map { { "a", 7U }, { "b", std::nullopt } };
+    const std::array<double, 2> doubles { 0.5, -1.25 };
+
+    ASSERT_EQ(roundTrip(numbers), numbers);
+    ASSERT_EQ(roundTrip(text), text);
+    ASSERT_EQ(roundTrip(map), map);
+    ASSERT_EQ(roundTrip(doubles), doubles);
+
+    // Two bytes of the size and the characters
+    ASSERT_EQ(compact::size(text), 2U + text.size());
+    ASSERT_EQ(compact::size(doubles), sizeof doubles);
+}
+
+TEST(CompactBinarySerializerTests, RejectMalformedVarints)
+{
+    {
+        // Doesn't fit 16 bits
+        const std::string data { "\x80\x80\x04", 3U };
+        BinaryReader reader { std::string_view(data) };
+        auto input = SerializationContext::create<CompactBinarySerializer>(reader);
+        std::uint16_t value {};
+        ASSERT_THROW(deserialize<CompactBinarySerializer>(input, value, ""), IOException);
+    }
+
+    {
+        const std::string data(12U, '\x80');
+        BinaryReader reader { std::string_view(data) };
+        auto input = SerializationContext::create<CompactBinarySerializer>(reader);
+        std::uint64_t value {};
+        ASSERT_THROW(deserialize<CompactBinarySerializer>(input, value, ""), IOException);
+    }
+
+    {
+        // The 10th byte carries bits above the 64th
+        const std::string data = std::string(9U, '\xFF') + '\x02';
+        BinaryReader reader { std::string_view(data) };
+        auto input = SerializationContext::create<CompactBinarySerializer>(reader);
+        std::uint64_t value {};
+        ASSERT_THROW(deserialize<CompactBinarySerializer>(input, value, ""), IOException);
+    }
+
+    {
+        const std::string data = std::string(9U, '\xFF') + '\x01';
+        BinaryReader reader { std::string_view(data) };
+        auto input = SerializationContext::create<CompactBinarySerializer>(reader);
+        std::uint64_t value {};
+        deserialize<CompactBinarySerializer>(input, value, "");
+        ASSERT_EQ(value, std::numeric_limits<std::uint64_t>::max());
+    }
+}
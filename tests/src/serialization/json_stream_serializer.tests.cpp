@@ -0,0 +1,219 @@
+/**
+ * @file    json_stream_serializer.tests.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+ISML_DISABLE_WARNINGS_PUSH
+#   include <gtest/gtest.h>
+ISML_DISABLE_WARNINGS_POP
+
+#include <isml/exceptions.hpp>
+
+#include <isml/serialization/serialization_utility.hpp>
+#include <isml/serialization/serializers/binary_serializer.hpp>
+#include <isml/serialization/serializers/json_stream_serializer.hpp>
+
+using namespace isml;
+
+using FieldSerializer = CompositeSerializer<BinarySerializer, JsonStreamSerializer>;
+
+namespace {
+
+enum class Color : std::uint8_t { Red = 1, Blue = 2 };
+
+struct Point : Serializable
+{
+    std::int32_t x {};
+    std::int32_t y {};
+
+    auto serialize(SerializationContext& context) const -> void override
+    {
+        isml::serialize<FieldSerializer>(context, x, "x");
+        isml::serialize<FieldSerializer>(context, y, "y");
+    }
+
+    auto deserialize(SerializationContext& context) -> void override
+    {
+        isml::deserialize<FieldSerializer>(context, x, "x");
+        isml::deserialize<FieldSerializer>(context, y, "y");
+    }
+};
+
+struct Record : Serializable
+{
+    bool                                  flag     {};
+    std::int64_t                          offset   {};
+    double                                ratio    {};
+    Color                                 color    {};
+    std::string                           name     {};
+    std::optional<std::uint16_t>          port     {};
+    std::pair<std::uint8_t, std::string>  tag      {};
+    std::vector<Point>                    points   {};
+    std::map<std::string, std::int32_t>   counters {};
+    std::map<std::uint32_t, std::string>  labels   {};
+    std::set<std::string>                 groups   {};
+    std::array<std::uint16_t, 3>          triple   {};
+
+    auto serialize(SerializationContext& context) const -> void override
+    {
+        isml::serialize<FieldSerializer>(context, flag, "flag");
+        isml::serialize<FieldSerializer>(context, offset, "offset");
+        isml::serialize<FieldSerializer>(context, ratio, "ratio");
+        isml::serialize<FieldSerializer>(context, color, "color");
+        isml::serialize<FieldSerializer>(context, name, "name");
+        isml::serialize<FieldSerializer>(context, port, "port");
+        isml::serialize<FieldSerializer>(context, tag, "tag");
+        isml::serialize<FieldSerializer>(context, points, "points");
+        isml::serialize<FieldSerializer>(context, counters, "counters");
+        isml::serialize<FieldSerializer>(context, labels, "labels");
+        isml::serialize<FieldSerializer>(context, groups, "groups");
+        isml::serialize<FieldSerializer>(context, triple, "triple");
+    }
+
+    auto deserialize(SerializationContext& context) -> void override
+    {
+        isml::deserialize<FieldSerializer>(context, flag, "flag");
+        isml::deserialize<FieldSerializer>(context, offset, "offset");
+        isml::deserialize<FieldSerializer>(context, ratio, "ratio");
+        isml::deserialize<FieldSerializer>(context, color, "color");
+        isml::deserialize<FieldSerializer>(context, name, "name");
+        isml::deserialize<FieldSerializer>(context, port, "port");
+        isml::deserialize<FieldSerializer>(context, tag, "tag");
+        isml::deserialize<FieldSerializer>(context, points, "points");
+        isml::deserialize<FieldSerializer>(context, counters, "counters");
+        isml::deserialize<FieldSerializer>(context, labels, "labels");
+        isml::deserialize<FieldSerializer>(context, groups, "groups");
+        isml::deserialize<FieldSerializer>(context, triple, "triple");
+    }
+};
+
+auto createRecord() -> Record
+{
+    Record record;
+    record.flag = true;
+    record.offset = -1234567890123LL;
+    record.ratio = 0.25;
+    record.color = Color::Blue;
+    record.name = "line\n\"quoted\"\t\x01";
+    record.port = 8080U;
+    record.tag = { 7U, "seven" };
+    record.points = { Point {}, Point {} };
+    record.points[1].x = -3;
+    record.points[1].y = 4;
+    record.counters = { { "a", 1 }, { "b", -2 } };
+    record.labels = { { 10U, "ten" } };
+    record.groups = { "admin", "users" };
+    record.triple = { 1U, 2U, 3U };
+    return record;
+}
+
+template<typename T>
+auto toJson(const T& value) -> std::string
+{
+    JsonWriter writer;
+    TypedSerializationContext<JsonStreamSerializer, JsonWriter> context { writer };
+    json::serialize(context, value);
+    return std::string(writer.view());
+}
+
+template<typename T>
+auto fromJson(std::string_view text, T& value) -> void
+{
+    JsonReader reader { text };
+    auto context = SerializationContext::create<JsonStreamSerializer>(reader);
+    json::deserialize(context, value);
+}
+
+} // namespace
+
+TEST(JsonStreamSerializerTests, WriteRecord)
+{
+    ASSERT_EQ(toJson(createRecord()),
+        R"({"flag":true,"offset":-1234567890123,"ratio":0.25,"color":2,)"
+        R"("name":"line\n\"quoted\"\t\u0001","port":8080,"tag":[7,"seven"],)"
+        R"("points":[{"x":0,"y":0},{"x":-3,"y":4}],"counters":{"a":1,"b":-2},)"
+        R"("labels":[[10,"ten"]],"groups":["admin","users"],"triple":[1,2,3]})");
+}
+
+TEST(JsonStreamSerializerTests, RoundTrip)
+{
+    const auto record = createRecord();
+
+    // Through a type-erased context dispatched by the composite serializer
+    JsonWriter writer;
+    auto output = SerializationContext::create<JsonStreamSerializer>(writer);
+    serialize<FieldSerializer>(output, record, "");
+    ASSERT_EQ(writer.view(), toJson(record));
+
+    Record result;
+    fromJson(writer.view(), result);
+
+    ASSERT_EQ(result.flag, record.flag);
+    ASSERT_EQ(result.offset, record.offset);
+    ASSERT_EQ(result.ratio, record.ratio);
+    ASSERT_EQ(result.color, record.color);
+    ASSERT_EQ(result.name, record.name);
+    ASSERT_EQ(result.port, record.port);
+    ASSERT_EQ(result.tag, record.tag);
+    ASSERT_EQ(result.points.size(), 2U);
+    ASSERT_EQ(result.points[1].x, -3);
+    ASSERT_EQ(result.points[1].y, 4);
+    ASSERT_EQ(result.counters, record.counters);
+    ASSERT_EQ(result.labels, record.labels);
+    ASSERT_EQ(result.groups, record.groups);
+    ASSERT_EQ(result.triple, record.triple);
+}
+
+TEST(JsonStreamSerializerTests, ReadReorderedMembers)
+{
+    // Members in another order, whitespace, unknown members and escapes
+    const std::string_view text = R"( { "y" : 20, "note": { "list": [1, "]", {"z": null}] },
+                                       "x" : -10 } )";
+    Point point;
+    fromJson(text, point);
+    ASSERT_EQ(point.x, -10);
+    ASSERT_EQ(point.y, 20);
+
+    std::string value;
+    fromJson(R"("\u00e9\ud83d\ude00\/")", value);
+    ASSERT_EQ(value, "\xC3\xA9\xF0\x9F\x98\x80/");
+
+    std::optional<std::int32_t> empty { 5 };
+    fromJson("null", empty);
+    ASSERT_FALSE(empty.has_value());
+
+    double nan {};
+    ASSERT_EQ(toJson(std::nan("")), "null");
+    fromJson("null", nan);
+    ASSERT_TRUE(std::isnan(nan));
+}
+
+TEST(JsonStreamSerializerTests, RejectInvalidInput)
+{
+    Point point;
+    ASSERT_THROW(fromJson(R"({"x":1})", point), IOException);
+    ASSERT_THROW(fromJson(R"({"x":1 "y":2})", point), IOException);
+    ASSERT_THROW(fromJson(R"({"x":1,"y":2)", point), IOException);
+    ASSERT_THROW(fromJson(R"({"x":1.5,"y":2})", point), IOException);
+
+    std::uint8_t byte {};
+    ASSERT_THROW(fromJson("256", byte), IOException);
+
+    std::array<std::uint16_t, 3> triple {};
+    ASSERT_THROW(fromJson("[1,2]", triple), IOException);
+    ASSERT_THROW(fromJson("[1,2,3,4]", triple), IOException);
+
+    std::string text;
+    ASSERT_THROW(fromJson(R"("open)", text), IOException);
+}
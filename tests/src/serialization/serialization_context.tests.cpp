@@ -0,0 +1,106 @@
+/**
+ * @file    serialization_context.tests.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+ISML_DISABLE_WARNINGS_PUSH
+#   include <gtest/gtest.h>
+ISML_DISABLE_WARNINGS_POP
+
+#include <isml/exceptions.hpp>
+
+#include <isml/serialization/serialization_utility.hpp>
+#include <isml/serialization/serializers/binary_serializer.hpp>
+#include <isml/serialization/serializers/compact_binary_serializer.hpp>
+
+using namespace isml;
+
+using FieldSerializer = CompositeSerializer<BinarySerializer, CompactBinarySerializer>;
+
+namespace {
+
+struct Record : Serializable
+{
+    std::uint32_t              id     {};
+    std::string                name   {};
+    std::vector<std::int16_t>  values {};
+
+    auto serialize(SerializationContext& context) const -> void override
+    {
+        isml::serialize<FieldSerializer>(context, id, "id");
+        isml::serialize<FieldSerializer>(context, name, "name");
+        isml::serialize<FieldSerializer>(context, values, "values");
+    }
+
+    auto deserialize(SerializationContext& context) -> void override
+    {
+        isml::deserialize<FieldSerializer>(context, id, "id");
+        isml::deserialize<FieldSerializer>(context, name, "name");
+        isml::deserialize<FieldSerializer>(context, values, "values");
+    }
+};
+
+} // namespace
+
+TEST(SerializationContextTests, TypedContextKeepsWireFormat)
+{
+    Record record;
+    record.id = 7U;
+    record.name = "typed";
+    record.values = { -1, 0, 300 };
+
+    BinaryWriter erased_writer;
+    auto erased = SerializationContext::create<CompactBinarySerializer>(erased_writer);
+    serialize<FieldSerializer>(erased, record, "");
+
+    BinaryWriter typed_writer;
+    TypedSerializationContext<CompactBinarySerializer, BinaryWriter> typed { typed_writer };
+    serialize<FieldSerializer>(typed, record, "");
+    ASSERT_EQ(typed_writer.view(), erased_writer.view());
+
+    Record result;
+    BinaryReader reader { typed_writer.view() };
+    TypedSerializationContext<CompactBinarySerializer, BinaryReader> input { reader };
+    deserialize<FieldSerializer>(input, result, "");
+
+    ASSERT_EQ(result.id, record.id);
+    ASSERT_EQ(result.name, record.name);
+    ASSERT_EQ(result.values, record.values);
+    ASSERT_EQ(reader.remaining(), 0U);
+}
+
+TEST(SerializationContextTests, TypedContextIsRecognized)
+{
+    BinaryWriter writer;
+    auto erased = SerializationContext::create<BinarySerializer>(writer);
+    TypedSerializationContext<BinarySerializer, BinaryWriter> typed { writer };
+    SerializationContext& typed_ref = typed;
+
+    ASSERT_TRUE(erased.uses<BinarySerializer>());
+    ASSERT_FALSE(erased.uses<CompactBinarySerializer>());
+    ASSERT_EQ((erased.typedAs<BinarySerializer, BinaryWriter>()), nullptr);
+
+    ASSERT_TRUE(typed_ref.typed());
+    ASSERT_EQ((typed_ref.typedAs<BinarySerializer, BinaryWriter>()), &typed);
+    ASSERT_EQ((typed_ref.typedAs<BinarySerializer, BinaryReader>()), nullptr);
+    ASSERT_EQ((typed_ref.typedAs<CompactBinarySerializer, BinaryWriter>()), nullptr);
+
+    ASSERT_EQ(&typed_ref.stream<BinaryWriter>(), &writer);
+    ASSERT_THROW(typed_ref.stream<BinaryReader>(), InvalidCastException);
+}
+
+TEST(SerializationContextTests, UnsupportedSerializerIsRejected)
+{
+    BinaryWriter writer;
+    TypedSerializationContext<CompactBinarySerializer, BinaryWriter> typed { writer };
+    auto erased = SerializationContext::create<CompactBinarySerializer>(writer);
+
+    ASSERT_THROW(serialize<CompositeSerializer<BinarySerializer>>(typed, std::uint8_t {}, ""), IOException);
+    ASSERT_THROW(serialize<CompositeSerializer<BinarySerializer>>(erased, std::uint8_t {}, ""), IOException);
+    ASSERT_EQ(writer.size(), 0U);
+}
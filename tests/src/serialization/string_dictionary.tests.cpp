@@ -0,0 +1,97 @@
+/**
+ * @file    string_dictionary.tests.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#include <string>
+#include <vector>
+
+ISML_DISABLE_WARNINGS_PUSH
+#   include <gtest/gtest.h>
+ISML_DISABLE_WARNINGS_POP
+
+#include <isml/exceptions.hpp>
+
+#include <isml/serialization/serialization_utility.hpp>
+#include <isml/serialization/serializers/binary_serializer.hpp>
+#include <isml/serialization/string_dictionary.hpp>
+
+using namespace isml;
+
+TEST(StringDictionaryTests, EvictLeastRecentlyUsed)
+{
+    StringDictionary dictionary { 2U };
+
+    ASSERT_TRUE(dictionary.intern("a").inserted);
+    ASSERT_TRUE(dictionary.intern("b").inserted);
+    ASSERT_FALSE(dictionary.intern("a").inserted);
+
+    // "b" is the least recently used one, so "c" takes its identifier
+    const auto c = dictionary.intern("c");
+    ASSERT_TRUE(c.inserted);
+    ASSERT_EQ(c.id, 1U);
+    ASSERT_EQ(dictionary.intern("a").id, 0U);
+    ASSERT_TRUE(dictionary.intern("b").inserted);
+    ASSERT_EQ(dictionary.size(), 2U);
+
+    ASSERT_FALSE(dictionary.accepts(""));
+    ASSERT_FALSE(dictionary.accepts(std::string(StringDictionary::k_default_max_length + 1U, 'x')));
+}
+
+TEST(StringDictionaryTests, RepeatedStringsAreSentOnce)
+{
+    const std::vector<std::string> strings { "AAPL", "MSFT", "AAPL", "", "AAPL", "GOOG", "MSFT" };
+
+    StringDictionary encoder { 2U };
+    BinaryWriter writer;
+    auto output = SerializationContext::create<BinarySerializer>(writer);
+    output.setDictionary(&encoder);
+    for (const auto& value : strings)
+        serialize<BinarySerializer>(output, value, "");
+
+    // Definitions: AAPL, MSFT, GOOG (evicting MSFT) and MSFT again (evicting
+    // AAPL); references: AAPL twice; the empty string is a literal
+    ASSERT_EQ(writer.size(), 4U * (2U + 2U + 4U) + 2U * 2U + (2U + 2U));
+
+    StringDictionary decoder { 2U };
+    BinaryReader reader { writer.view() };
+    auto input = SerializationContext::create<BinarySerializer>(reader);
+    input.setDictionary(&decoder);
+    for (const auto& value : strings)
+    {
+        std::string result;
+        deserialize<BinarySerializer>(input, result, "");
+        ASSERT_EQ(result, value);
+    }
+    ASSERT_EQ(reader.remaining(), 0U);
+}
+
+TEST(StringDictionaryTests, UnknownIdentifierIsRejected)
+{
+    const std::string data { "\x05\x00", 2U };
+
+    StringDictionary decoder;
+    BinaryReader reader { std::string_view(data) };
+    auto input = SerializationContext::create<BinarySerializer>(reader);
+    input.setDictionary(&decoder);
+
+    std::string result;
+    ASSERT_THROW(deserialize<BinarySerializer>(input, result, ""), IOException);
+}
+
+TEST(StringDictionaryTests, ClearedIdentifiersAreRejected)
+{
+    StringDictionary decoder;
+    decoder.define(2U, "symbol");
+    ASSERT_EQ(decoder.at(2U), "symbol");
+
+    // Identifiers below a defined one aren't defined
+    ASSERT_THROW(decoder.at(0U), IOException);
+
+    decoder.clear();
+    ASSERT_THROW(decoder.at(2U), IOException);
+
+    decoder.define(0U, "other");
+    ASSERT_EQ(decoder.at(0U), "other");
+}
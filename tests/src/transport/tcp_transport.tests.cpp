@@ -0,0 +1,979 @@
+/**
+ * @file    tcp_transport.tests.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+ISML_DISABLE_WARNINGS_PUSH
+#   include <gtest/gtest.h>
+#   include <boost/asio/executor_work_guard.hpp>
+#   include <boost/asio/io_context.hpp>
+#   include <boost/asio/ip/tcp.hpp>
+#   include <boost/asio/write.hpp>
+ISML_DISABLE_WARNINGS_POP
+
+#include <isml/base/borrowed.hpp>
+
+#include <isml/serialization/serializers/composite_serializer.hpp>
+#include <isml/serialization/serializers/binary_serializer.hpp>
+#include <isml/serialization/serializers/compact_binary_serializer.hpp>
+
+#include <isml/executors/thread_pool_task_executor.hpp>
+
+#include <isml/message/message_factory.hpp>
+#include <isml/session/session.hpp>
+#include <isml/transport/tcp_transport.hpp>
+#include <isml/transport/tcp_transport_factory.hpp>
+
+#include <isml/utility/crc32c.hpp>
+
+using namespace isml;
+using namespace std::chrono_literals;
+
+using FieldSerializer = CompositeSerializer<BinarySerializer, CompactBinarySerializer>;
+
+namespace {
+
+enum TestMessageType : MessageType { Sequence = 0x7E02, Bulk = 0x7E03, Borrowing = 0x7E04 };
+
+class TcpTransportTests : public ::testing::Test
+{
+protected:
+    auto SetUp() -> void override
+    {
+        MessageFactory::getInstance().addDescriptor(TestMessageType::Sequence, [](MessageDescriptor& descriptor)
+            {
+                descriptor.registerField<FieldSerializer, std::uint32_t>("seq");
+                descriptor.registerField<FieldSerializer, std::string>("payload");
+            });
+
+        // A string holds at most 64 KiB, so a large message is made of several ones
+        MessageFactory::getInstance().addDescriptor(TestMessageType::Bulk, [](MessageDescriptor& descriptor)
+            {
+                for (const auto* name : k_bulk_fields)
+                    descriptor.registerField<FieldSerializer, std::string>(name);
+            });
+
+        MessageFactory::getInstance().addDescriptor(TestMessageType::Borrowing, [](MessageDescriptor& descriptor)
+            {
+                descriptor.registerField<FieldSerializer, std::uint32_t>("seq");
+                descriptor.registerField<FieldSerializer, BorrowedString>("payload");
+            });
+
+        m_acceptor.open(boost::asio::ip::tcp::v4());
+        m_acceptor.bind({ boost::asio::ip::make_address("127.0.0.1"), 0 });
+        m_acceptor.listen();
+
+        m_io = std::async(std::launch::async, [this]
+            {
+                auto guard = boost::asio::make_work_guard(m_ioc);
+                m_ioc.run();
+            });
+    }
+
+    auto TearDown() -> void override
+    {
+        m_ioc.stop();
+        m_io.wait();
+    }
+
+    auto url(const std::string& query) const -> Url
+    {
+        return Url::parse("tcp://127.0.0.1:" + std::to_string(m_acceptor.local_endpoint().port()) + query);
+    }
+
+    auto accept(TransportOptions options) -> std::future<Session::Ptr>
+    {
+        return std::async(std::launch::async, [this, options]
+            {
+                return Session::createNew(1, std::make_unique<TcpTransport>(m_acceptor.accept(), options));
+            });
+    }
+
+    template<typename Predicate>
+    static auto waitFor(Predicate&& predicate) -> bool
+    {
+        for (auto deadline = std::chrono::steady_clock::now() + 5s; std::chrono::steady_clock::now() < deadline;)
+        {
+            if (predicate()) return true;
+            std::this_thread::sleep_for(10ms);
+        }
+        return false;
+    }
+
+    // The receiver doesn't drain its queue, so the sender must stop once the
+    // window is exhausted and resume as the receiver takes the messages.
+    auto checkFlowControl(const std::string& query, TransportOptions options, std::uint64_t max_in_flight) -> void
+    {
+        constexpr std::uint32_t k_count = 32U;
+
+        TcpTransportFactory factory { m_ioc };
+        auto server = accept(options);
+        auto transport_res = factory.createTransport(url(query));
+        ASSERT_TRUE(transport_res);
+
+        auto server_session = server.get();
+        auto client_session = Session::createNew(2, std::move(transport_res.value()));
+
+        auto& sender = dynamic_cast<TcpTransport&>(*client_session->transport());
+        auto& receiver = dynamic_cast<TcpTransport&>(*server_session->transport());
+
+        for (std::uint32_t seq = 0; seq < k_count; ++seq)
+        {
+            auto msg = MessageFactory::getInstance().createMessage(TestMessageType::Sequence, *client_session);
+            msg->field<std::uint32_t>("seq") = seq;
+            msg->field<std::string>("payload") = std::string(100, 'x');
+            client_session->send(std::move(msg));
+        }
+
+        ASSERT_TRUE(waitFor([&]{ return sender.statistics().credit_stalls > 0; }));
+        std::this_thread::sleep_for(50ms);
+        ASSERT_LE(receiver.statistics().messages_received, max_in_flight);
+
+        for (std::uint32_t seq = 0; seq < k_count; ++seq)
+        {
+            std::optional<Message::Ptr> received;
+            ASSERT_TRUE(waitFor([&]{ return (received = server_session->receive()).has_value(); }));
+            ASSERT_EQ((*received)->field<std::uint32_t>("seq").get(), seq);
+        }
+
+        ASSERT_EQ(sender.statistics().messages_sent, k_count);
+        ASSERT_GT(receiver.statistics().credit_frames, 0U);
+
+        client_session->shutdown();
+        server_session->shutdown();
+    }
+
+    // A message of about 200 KB sent without the multiplexing must be split
+    // into frames and reassembled
+    auto checkLargeMessage(const std::string& query, TransportOptions options, std::uint64_t zero_copy_frames) -> void
+    {
+        constexpr std::size_t k_part_size = 50000U;
+
+        TcpTransportFactory factory { m_ioc };
+        auto server = accept(options);
+        auto transport_res = factory.createTransport(url(query));
+        ASSERT_TRUE(transport_res);
+
+        auto server_session = server.get();
+        auto client_session = Session::createNew(2, std::move(transport_res.value()));
+
+        auto bulk = MessageFactory::getInstance().createMessage(TestMessageType::Bulk, *client_session);
+        for (const auto* name : k_bulk_fields)
+            bulk->field<std::string>(name) = std::string(k_part_size, name[0]);
+        client_session->send(std::move(bulk));
+
+        auto msg = MessageFactory::getInstance().createMessage(TestMessageType::Sequence, *client_session);
+        msg->field<std::uint32_t>("seq") = 1U;
+        client_session->send(std::move(msg));
+
+        std::optional<Message::Ptr> received;
+        ASSERT_TRUE(waitFor([&]{ return (received = server_session->receive()).has_value(); }));
+        ASSERT_EQ((*received)->type(), TestMessageType::Bulk);
+        for (const auto* name : k_bulk_fields)
+            ASSERT_EQ((*received)->field<std::string>(name).get(), std::string(k_part_size, name[0]));
+
+        ASSERT_TRUE(waitFor([&]{ return (received = server_session->receive()).has_value(); }));
+        ASSERT_EQ((*received)->field<std::uint32_t>("seq").get(), 1U);
+
+        auto& sender = dynamic_cast<TcpTransport&>(*client_session->transport());
+        ASSERT_EQ(sender.statistics().messages_sent, 2U);
+        ASSERT_EQ(sender.statistics().zero_copy_frames, zero_copy_frames);
+
+        client_session->shutdown();
+        server_session->shutdown();
+    }
+
+protected:
+    static constexpr const char* k_bulk_fields[] { "a", "b", "c", "d" };
+
+    boost::asio::io_context        m_ioc      {};
+    std::future<void>              m_io       {};
+    boost::asio::ip::tcp::acceptor m_acceptor { m_ioc };
+};
+
+} // namespace
+
+TEST_F(TcpTransportTests, ExchangeMessages)
+{
+    TcpTransportFactory factory { m_ioc };
+    auto server = accept({});
+    auto transport_res = factory.createTransport(url(""));
+    ASSERT_TRUE(transport_res);
+
+    auto server_session = server.get();
+    auto client_session = Session::createNew(2, std::move(transport_res.value()));
+
+    auto msg = MessageFactory::getInstance().createMessage(TestMessageType::Sequence, *server_session);
+    msg->field<std::uint32_t>("seq") = 42U;
+    server_session->send(std::move(msg));
+
+    std::optional<Message::Ptr> received;
+    ASSERT_TRUE(waitFor([&]{ return (received = client_session->receive()).has_value(); }));
+    ASSERT_EQ((*received)->field<std::uint32_t>("seq").get(), 42U);
+
+    client_session->shutdown();
+    server_session->shutdown();
+}
+
+TEST_F(TcpTransportTests, MessageCreditsLimitMessagesInFlight)
+{
+    checkFlowControl("?credits=messages&window=4", TransportOptions::withCredits(FlowControl::Messages, 4U), 4U);
+}
+
+TEST_F(TcpTransportTests, ByteCreditsLimitBytesInFlight)
+{
+    // Every message takes more than 100 bytes, the last one may overdraw the window
+    checkFlowControl("?credits=bytes&window=512", TransportOptions::withCredits(FlowControl::Bytes, 512U), 6U);
+}
+
+TEST_F(TcpTransportTests, RejectUnknownFlowControlMode)
+{
+    TcpTransportFactory factory { m_ioc };
+    ASSERT_FALSE(factory.createTransport(url("?credits=unknown")));
+}
+
+TEST_F(TcpTransportTests, MultiplexedStreamsInterleave)
+{
+    auto options = TransportOptions::withCredits(FlowControl::Bytes, 4096U);
+    options.multiplexing = true;
+    options.max_chunk_size = 1024U;
+
+    TcpTransportFactory factory { m_ioc };
+    auto server = accept(options);
+    auto transport_res = factory.createTransport(url("?credits=bytes&window=4096&streams=1&chunk=1024"));
+    ASSERT_TRUE(transport_res);
+
+    auto server_session = server.get();
+    auto client_session = Session::createNew(2, std::move(transport_res.value()));
+
+    auto send = [&](StreamId stream_id, std::uint32_t seq, std::size_t size)
+        {
+            auto msg = MessageFactory::getInstance().createMessage(TestMessageType::Sequence, *client_session);
+            msg->setStreamId(stream_id);
+            msg->field<std::uint32_t>("seq") = seq;
+            msg->field<std::string>("payload") = std::string(size, 'x');
+            client_session->send(std::move(msg));
+        };
+
+    // Bulk transfer on the first stream, a short conversation on the second one
+    send(1U, 0U, 60000U);
+    send(1U, 1U, 60000U);
+    send(2U, 2U, 10U);
+    send(2U, 3U, 10U);
+
+    std::vector<std::uint32_t> order;
+    while (order.size() < 4U)
+    {
+        std::optional<Message::Ptr> received;
+        ASSERT_TRUE(waitFor([&]{ return (received = server_session->receive()).has_value(); }));
+        ASSERT_EQ((*received)->streamId(), ((*received)->field<std::uint32_t>("seq").get() < 2U) ? 1U : 2U);
+        order.push_back((*received)->field<std::uint32_t>("seq").get());
+    }
+
+    ASSERT_EQ(order, (std::vector<std::uint32_t> { 2U, 3U, 0U, 1U }));
+
+    client_session->shutdown();
+    server_session->shutdown();
+}
+
+TEST_F(TcpTransportTests, TimestampMessages)
+{
+    struct Listener : TransportListener
+    {
+        auto onStateChanged(Transport&, State, State) -> void override {}
+        auto onErrorOccurred(Transport&, const std::error_code&) -> void override {}
+
+        auto onMessageTransmitted(Transport&, MessageId id, std::chrono::nanoseconds written,
+            const SocketTimestamp& transmitted) -> void override
+        {
+            if (transmitted.software >= written)
+                transmitted_id = id;
+        }
+
+        std::atomic<MessageId> transmitted_id {};
+    };
+
+    TransportOptions options;
+    options.timestamping = Timestamping::Software;
+
+    TcpTransportFactory factory { m_ioc };
+    auto server = accept(options);
+    auto transport_res = factory.createTransport(url("?timestamps=software"));
+    ASSERT_TRUE(transport_res);
+
+    auto server_session = server.get();
+    auto client_session = Session::createNew(2, std::move(transport_res.value()));
+
+    auto listener = std::make_shared<Listener>();
+    client_session->transport()->addListener(listener);
+
+    auto msg = MessageFactory::getInstance().createMessage(TestMessageType::Sequence, *client_session);
+    const auto msg_id = msg->id();
+    client_session->send(std::move(msg));
+
+    std::optional<Message::Ptr> received;
+    ASSERT_TRUE(waitFor([&]{ return (received = server_session->receive()).has_value(); }));
+
+    const auto& timestamps = (*received)->timestamps();
+    ASSERT_GT(timestamps.wire.software.count(), 0);
+    ASSERT_GE(timestamps.received, timestamps.wire.software);
+
+    auto& receiver = dynamic_cast<TcpTransport&>(*server_session->transport());
+    ASSERT_EQ(receiver.statistics().rx_timestamps, 1U);
+
+    ASSERT_TRUE(waitFor([&]{ return listener->transmitted_id == msg_id; }));
+
+    auto& sender = dynamic_cast<TcpTransport&>(*client_session->transport());
+    ASSERT_EQ(sender.statistics().tx_timestamps, 1U);
+
+    client_session->shutdown();
+    server_session->shutdown();
+}
+
+TEST_F(TcpTransportTests, ZeroCopyLargeFrames)
+{
+    TcpTransportFactory factory { m_ioc };
+    auto server = accept({});
+    auto transport_res = factory.createTransport(url("?zerocopy=4096"));
+    ASSERT_TRUE(transport_res);
+
+    auto server_session = server.get();
+    auto client_session = Session::createNew(2, std::move(transport_res.value()));
+
+    for (std::uint32_t seq = 0; seq < 4U; ++seq)
+    {
+        auto msg = MessageFactory::getInstance().createMessage(TestMessageType::Sequence, *client_session);
+        msg->field<std::uint32_t>("seq") = seq;
+        msg->field<std::string>("payload") = std::string((seq % 2U) ? 10U : 20000U, 'x');
+        client_session->send(std::move(msg));
+    }
+
+    for (std::uint32_t seq = 0; seq < 4U; ++seq)
+    {
+        std::optional<Message::Ptr> received;
+        ASSERT_TRUE(waitFor([&]{ return (received = server_session->receive()).has_value(); }));
+        ASSERT_EQ((*received)->field<std::uint32_t>("seq").get(), seq);
+        ASSERT_EQ((*received)->field<std::string>("payload").get().size(), (seq % 2U) ? 10U : 20000U);
+    }
+
+    auto& sender = dynamic_cast<TcpTransport&>(*client_session->transport());
+    ASSERT_EQ(sender.statistics().zero_copy_frames, 2U);
+
+    // Loopback delivers the pinned pages by copying them
+    ASSERT_TRUE(waitFor([&]{ return sender.statistics().zero_copy_copied == 2U; }));
+
+    client_session->shutdown();
+    server_session->shutdown();
+}
+
+TEST_F(TcpTransportTests, SplitLargeMessagesWithoutMultiplexing)
+{
+    checkLargeMessage("", {}, 0U);
+}
+
+TEST_F(TcpTransportTests, SplitLargeMessagesWithZeroCopy)
+{
+    // Four chunks, the last one is below the threshold
+    checkLargeMessage("?zerocopy=4096", {}, 3U);
+}
+
+TEST_F(TcpTransportTests, SplitLargeChecksummedMessages)
+{
+    auto options = TransportOptions::withCredits(FlowControl::Bytes, 65536U);
+    options.frame_checksum = true;
+    checkLargeMessage("?crc=1&credits=bytes&window=65536", options, 0U);
+}
+
+TEST_F(TcpTransportTests, EncodeOnExecutorKeepsOrder)
+{
+    constexpr std::uint32_t k_count = 64U;
+
+    TcpTransportFactory factory { m_ioc };
+    auto server = accept({});
+    auto transport_res = factory.createTransport(url("?encode=executor&accounting=1"));
+    ASSERT_TRUE(transport_res);
+
+    auto& sender = dynamic_cast<TcpTransport&>(*transport_res.value());
+    ASSERT_EQ(sender.options().encoding, Encoding::Executor);
+    sender.setEncodingExecutor(std::make_shared<ThreadPoolTaskExecutor>(4U));
+
+    auto server_session = server.get();
+    auto client_session = Session::createNew(2, std::move(transport_res.value()));
+
+    for (std::uint32_t seq = 0; seq < k_count; ++seq)
+    {
+        auto msg = MessageFactory::getInstance().createMessage(TestMessageType::Sequence, *client_session);
+        msg->field<std::uint32_t>("seq") = seq;
+        msg->field<std::string>("payload") = std::string(seq * 16U, 'x');
+        client_session->send(std::move(msg));
+    }
+
+    for (std::uint32_t seq = 0; seq < k_count; ++seq)
+    {
+        std::optional<Message::Ptr> received;
+        ASSERT_TRUE(waitFor([&]{ return (received = server_session->receive()).has_value(); }));
+        ASSERT_EQ((*received)->field<std::uint32_t>("seq").get(), seq);
+        ASSERT_EQ((*received)->field<std::string>("payload").get().size(), seq * 16U);
+    }
+
+    ASSERT_EQ(sender.statistics().messages_encoded, k_count);
+    ASSERT_GT(sender.statistics().encode_cpu_ns, 0U);
+    ASSERT_GT(sender.statistics().write_cpu_ns, 0U);
+
+    client_session->shutdown();
+    server_session->shutdown();
+}
+
+TEST_F(TcpTransportTests, DecodeOnExecutorKeepsOrder)
+{
+    constexpr std::uint32_t k_count = 64U;
+
+    TcpTransportFactory factory { m_ioc };
+    auto server = accept({});
+    auto transport_res = factory.createTransport(url("?decode=executor&accounting=1"));
+    ASSERT_TRUE(transport_res);
+
+    auto& receiver = dynamic_cast<TcpTransport&>(*transport_res.value());
+    ASSERT_EQ(receiver.options().decoding, Decoding::Executor);
+    receiver.setDecodingExecutor(std::make_shared<ThreadPoolTaskExecutor>(4U));
+
+    auto server_session = server.get();
+    auto client_session = Session::createNew(2, std::move(transport_res.value()));
+
+    for (std::uint32_t seq = 0; seq < k_count; ++seq)
+    {
+        auto msg = MessageFactory::getInstance().createMessage(TestMessageType::Sequence, *server_session);
+        msg->field<std::uint32_t>("seq") = seq;
+        msg->field<std::string>("payload") = std::string(seq * 16U, 'x');
+        server_session->send(std::move(msg));
+    }
+
+    for (std::uint32_t seq = 0; seq < k_count; ++seq)
+    {
+        std::optional<Message::Ptr> received;
+        ASSERT_TRUE(waitFor([&]{ return (received = client_session->receive()).has_value(); }));
+        ASSERT_EQ((*received)->field<std::uint32_t>("seq").get(), seq);
+        ASSERT_EQ((*received)->field<std::string>("payload").get().size(), seq * 16U);
+    }
+
+    ASSERT_EQ(receiver.statistics().messages_received, k_count);
+    ASSERT_GT(receiver.statistics().decode_cpu_ns, 0U);
+
+    client_session->shutdown();
+    server_session->shutdown();
+}
+
+TEST_F(TcpTransportTests, StopOnEncodingExecutorThread)
+{
+    TcpTransportFactory factory { m_ioc };
+    auto server = accept({});
+    auto transport_res = factory.createTransport(url("?encode=executor"));
+    ASSERT_TRUE(transport_res);
+
+    auto executor = std::make_shared<ThreadPoolTaskExecutor>(1U);
+    auto& sender = dynamic_cast<TcpTransport&>(*transport_res.value());
+    sender.setEncodingExecutor(executor);
+
+    auto server_session = server.get();
+    auto client_session = Session::createNew(2, std::move(transport_res.value()));
+
+    // The encoding task is queued behind the one stopping the transport
+    std::promise<void> stopped;
+    executor->execute([&]
+        {
+            auto msg = MessageFactory::getInstance().createMessage(TestMessageType::Sequence, *client_session);
+            client_session->send(std::move(msg));
+            sender.stop();
+            stopped.set_value();
+        });
+
+    ASSERT_EQ(stopped.get_future().wait_for(5s), std::future_status::ready);
+    ASSERT_EQ(sender.statistics().messages_encoded, 0U);
+
+    client_session->shutdown();
+    server_session->shutdown();
+}
+
+TEST_F(TcpTransportTests, HandshakeNegotiatesCapabilities)
+{
+    TransportOptions options;
+    options.handshake = true;
+
+    TcpTransportFactory factory { m_ioc };
+    auto server = accept(options);
+    auto transport_res = factory.createTransport(url("?handshake=1"));
+    ASSERT_TRUE(transport_res);
+
+    auto server_session = server.get();
+    auto client_session = Session::createNew(2, std::move(transport_res.value()));
+
+    ASSERT_TRUE(waitFor([&]{ return client_session->capabilities() and server_session->capabilities(); }));
+
+    const auto capabilities = client_session->capabilities().value();
+    ASSERT_EQ(capabilities.version, SessionCapabilities::k_protocol_version);
+    ASSERT_TRUE(capabilities.supports(SessionCapabilities::Binary));
+    ASSERT_TRUE(capabilities.schema_match);
+    ASSERT_EQ(capabilities.schema_fingerprint, MessageFactory::getInstance().fingerprint());
+
+    // The hello message is not delivered to the application
+    auto msg = MessageFactory::getInstance().createMessage(TestMessageType::Sequence, *client_session);
+    msg->field<std::uint32_t>("seq") = 7U;
+    client_session->send(std::move(msg));
+
+    std::optional<Message::Ptr> received;
+    ASSERT_TRUE(waitFor([&]{ return (received = server_session->receive()).has_value(); }));
+    ASSERT_EQ((*received)->field<std::uint32_t>("seq").get(), 7U);
+
+    client_session->shutdown();
+    server_session->shutdown();
+}
+
+TEST_F(TcpTransportTests, ExchangeCompactMessages)
+{
+    TransportOptions options;
+    options.codec = Codec::CompactBinary;
+
+    TcpTransportFactory factory { m_ioc };
+    auto server = accept(options);
+    auto transport_res = factory.createTransport(url("?codec=compact"));
+    ASSERT_TRUE(transport_res);
+
+    auto server_session = server.get();
+    auto client_session = Session::createNew(2, std::move(transport_res.value()));
+
+    auto msg = MessageFactory::getInstance().createMessage(TestMessageType::Sequence, *client_session);
+    msg->field<std::uint32_t>("seq") = 300U;
+    msg->field<std::string>("payload") = std::string("compact");
+    client_session->send(std::move(msg));
+
+    std::optional<Message::Ptr> received;
+    ASSERT_TRUE(waitFor([&]{ return (received = server_session->receive()).has_value(); }));
+    ASSERT_EQ((*received)->field<std::uint32_t>("seq").get(), 300U);
+    ASSERT_EQ((*received)->field<std::string>("payload").get(), "compact");
+
+    // Length prefix, type (3 bytes), seq (2 bytes), payload size (1 byte) and payload
+    auto& sender = dynamic_cast<TcpTransport&>(*client_session->transport());
+    ASSERT_TRUE(waitFor([&]{ return sender.statistics().bytes_sent == 2U + 3U + 2U + 1U + 7U; }));
+
+    client_session->shutdown();
+    server_session->shutdown();
+}
+
+TEST_F(TcpTransportTests, ExchangeSparseMessages)
+{
+    TransportOptions options;
+    options.field_presence = true;
+
+    TcpTransportFactory factory { m_ioc };
+    auto server = accept(options);
+    auto transport_res = factory.createTransport(url("?presence=1"));
+    ASSERT_TRUE(transport_res);
+
+    auto server_session = server.get();
+    auto client_session = Session::createNew(2, std::move(transport_res.value()));
+
+    auto msg = MessageFactory::getInstance().createMessage(TestMessageType::Sequence, *client_session);
+    msg->field<std::string>("payload") = std::string("sparse");
+    client_session->send(std::move(msg));
+
+    std::optional<Message::Ptr> received;
+    ASSERT_TRUE(waitFor([&]{ return (received = server_session->receive()).has_value(); }));
+    ASSERT_EQ((*received)->field<std::uint32_t>("seq").get(), 0U);
+    ASSERT_EQ((*received)->field<std::string>("payload").get(), "sparse");
+
+    // Length prefix, type, bitmap, payload size and payload (seq is omitted)
+    auto& sender = dynamic_cast<TcpTransport&>(*client_session->transport());
+    ASSERT_TRUE(waitFor([&]{ return sender.statistics().bytes_sent == 2U + 2U + 1U + 2U + 6U; }));
+
+    client_session->shutdown();
+    server_session->shutdown();
+}
+
+TEST_F(TcpTransportTests, ExchangeIndexedMessages)
+{
+    TransportOptions options;
+    options.indexed_layout = true;
+
+    TcpTransportFactory factory { m_ioc };
+    auto server = accept(options);
+    auto transport_res = factory.createTransport(url("?indexed=1"));
+    ASSERT_TRUE(transport_res);
+
+    auto server_session = server.get();
+    auto client_session = Session::createNew(2, std::move(transport_res.value()));
+
+    auto msg = MessageFactory::getInstance().createMessage(TestMessageType::Sequence, *client_session);
+    msg->field<std::uint32_t>("seq") = 7U;
+    msg->field<std::string>("payload") = std::string("indexed");
+    client_session->send(std::move(msg));
+
+    std::optional<Message::Ptr> received;
+    ASSERT_TRUE(waitFor([&]{ return (received = server_session->receive()).has_value(); }));
+    ASSERT_EQ((*received)->field<std::uint32_t>("seq").get(), 7U);
+    ASSERT_EQ((*received)->field<std::string>("payload").get(), "indexed");
+
+    // Length prefix, type, offset table (2 entries), seq, payload size and payload
+    auto& sender = dynamic_cast<TcpTransport&>(*client_session->transport());
+    ASSERT_TRUE(waitFor([&]{ return sender.statistics().bytes_sent == 2U + 2U + 8U + 4U + 2U + 7U; }));
+
+    ASSERT_THROW(TransportOptions::fromUrl(url("?indexed=1&presence=1")), std::invalid_argument);
+
+    client_session->shutdown();
+    server_session->shutdown();
+}
+
+TEST_F(TcpTransportTests, ExchangeDeltaMessages)
+{
+    TransportOptions options;
+    options.delta_encoding = true;
+    options.keyframe_interval = 2U;
+
+    TcpTransportFactory factory { m_ioc };
+    auto server = accept(options);
+    auto transport_res = factory.createTransport(url("?delta=1&keyframe=2"));
+    ASSERT_TRUE(transport_res);
+
+    auto server_session = server.get();
+    auto client_session = Session::createNew(2, std::move(transport_res.value()));
+
+    for (std::uint32_t seq = 1U; seq <= 3U; ++seq)
+    {
+        auto msg = MessageFactory::getInstance().createMessage(TestMessageType::Sequence, *client_session);
+        msg->field<std::uint32_t>("seq") = seq;
+        msg->field<std::string>("payload") = std::string(100, 'x');
+        client_session->send(std::move(msg));
+    }
+
+    for (std::uint32_t seq = 1U; seq <= 3U; ++seq)
+    {
+        std::optional<Message::Ptr> received;
+        ASSERT_TRUE(waitFor([&]{ return (received = server_session->receive()).has_value(); }));
+        ASSERT_EQ((*received)->field<std::uint32_t>("seq").get(), seq);
+        ASSERT_EQ((*received)->field<std::string>("payload").get(), std::string(100, 'x'));
+    }
+
+    // Keyframe: length prefix, type, kind, seq, payload size and payload;
+    // delta: length prefix, type, kind, bitmap and seq
+    constexpr std::uint64_t k_keyframe_size = 2U + 2U + 1U + 4U + 2U + 100U;
+    constexpr std::uint64_t k_delta_size = 2U + 2U + 1U + 1U + 4U;
+
+    auto& sender = dynamic_cast<TcpTransport&>(*client_session->transport());
+    ASSERT_TRUE(waitFor([&]{ return sender.statistics().bytes_sent == 2U * k_keyframe_size + k_delta_size; }));
+
+    client_session->shutdown();
+    server_session->shutdown();
+}
+
+TEST_F(TcpTransportTests, ExchangeInternedStrings)
+{
+    TransportOptions options;
+    options.string_dictionary = 16U;
+
+    TcpTransportFactory factory { m_ioc };
+    auto server = accept(options);
+    auto transport_res = factory.createTransport(url("?dictionary=16"));
+    ASSERT_TRUE(transport_res);
+
+    auto server_session = server.get();
+    auto client_session = Session::createNew(2, std::move(transport_res.value()));
+
+    for (std::uint32_t seq = 1U; seq <= 2U; ++seq)
+    {
+        auto msg = MessageFactory::getInstance().createMessage(TestMessageType::Sequence, *client_session);
+        msg->field<std::uint32_t>("seq") = seq;
+        msg->field<std::string>("payload") = std::string("symbol");
+        client_session->send(std::move(msg));
+    }
+
+    for (std::uint32_t seq = 1U; seq <= 2U; ++seq)
+    {
+        std::optional<Message::Ptr> received;
+        ASSERT_TRUE(waitFor([&]{ return (received = server_session->receive()).has_value(); }));
+        ASSERT_EQ((*received)->field<std::uint32_t>("seq").get(), seq);
+        ASSERT_EQ((*received)->field<std::string>("payload").get(), "symbol");
+    }
+
+    // The first message resets the dictionary and defines the string
+    // (prefix, size and characters), the second one refers to it by the
+    // prefix only
+    constexpr std::uint64_t k_first_size = 2U + 2U + 1U + 4U + 2U + 2U + 6U;
+    constexpr std::uint64_t k_second_size = 2U + 2U + 1U + 4U + 2U;
+
+    auto& sender = dynamic_cast<TcpTransport&>(*client_session->transport());
+    ASSERT_TRUE(waitFor([&]{ return sender.statistics().bytes_sent == k_first_size + k_second_size; }));
+
+    client_session->shutdown();
+    server_session->shutdown();
+}
+
+TEST_F(TcpTransportTests, DropStringsOfSkippedMessages)
+{
+    TransportOptions options;
+    options.string_dictionary = 16U;
+
+    auto server = accept(options);
+    TcpSocket peer { m_ioc };
+    peer.connect(m_acceptor.local_endpoint());
+    auto server_session = server.get();
+
+    // Frames of the sender whose dictionary assigns the identifier 0 to
+    // "alpha", then to "beta" in a message unknown to the receiver and to
+    // "gamma" after the reset
+    auto frame = [](MessageType type, std::uint32_t seq, TcpTransport::DictionaryFlags flags, std::string_view definition)
+        {
+            BinaryWriter body;
+            TypedSerializationContext<BinarySerializer, BinaryWriter> context { body };
+            binary::serialize(context, type);
+            binary::serialize(context, flags);
+            binary::serialize(context, seq);
+            if (definition.empty())
+            {
+                binary::serialize(context, std::uint16_t { 1U });
+            }
+            else
+            {
+                binary::serialize(context, std::uint16_t { 0x8000U });
+                binary::serialize(context, std::string(definition));
+            }
+
+            BinaryWriter writer;
+            TypedSerializationContext<BinarySerializer, BinaryWriter> frame_context { writer };
+            binary::serialize(frame_context, static_cast<MessageLength>(body.size()));
+            writer.write(body.data(), body.size());
+            return std::string { writer.view() };
+        };
+
+    constexpr MessageType k_unknown = 0x7E7FU;
+    const auto data = frame(TestMessageType::Sequence, 1U, TcpTransport::k_dictionary_reset, "alpha")
+                    + frame(k_unknown, 2U, 0U, "beta")
+                    + frame(TestMessageType::Sequence, 3U, 0U, {})
+                    + frame(TestMessageType::Sequence, 4U, TcpTransport::k_dictionary_reset, "gamma")
+                    + frame(TestMessageType::Sequence, 5U, 0U, {});
+    boost::asio::write(peer, boost::asio::buffer(data));
+
+    // The reference of the third message can't be resolved
+    for (const auto& [seq, payload] : { std::pair { 1U, "alpha" }, std::pair { 4U, "gamma" }, std::pair { 5U, "gamma" } })
+    {
+        std::optional<Message::Ptr> received;
+        ASSERT_TRUE(waitFor([&]{ return (received = server_session->receive()).has_value(); }));
+        ASSERT_EQ((*received)->field<std::uint32_t>("seq").get(), seq);
+        ASSERT_EQ((*received)->field<std::string>("payload").get(), payload);
+    }
+
+    ASSERT_FALSE(server_session->receive().has_value());
+
+    server_session->shutdown();
+}
+
+TEST_F(TcpTransportTests, DropCorruptedFrames)
+{
+    TransportOptions options;
+    options.frame_checksum = true;
+    ASSERT_TRUE(TransportOptions::fromUrl(url("?crc=1")).frame_checksum);
+
+    auto server = accept(options);
+    TcpSocket peer { m_ioc };
+    peer.connect(m_acceptor.local_endpoint());
+    auto server_session = server.get();
+
+    auto frame = [](std::uint32_t seq, bool corrupt)
+        {
+            BinaryWriter writer;
+            TypedSerializationContext<BinarySerializer, BinaryWriter> context { writer };
+            binary::serialize(context, MessageLength { 2U + 4U + 2U + 5U + 4U });
+            binary::serialize(context, static_cast<MessageType>(TestMessageType::Sequence));
+            binary::serialize(context, seq);
+            binary::serialize(context, std::string("hello"));
+            binary::serialize(context, Crc32c::compute(writer.view()));
+
+            std::string bytes { writer.view() };
+            if (corrupt)
+                bytes[8] ^= 0x10;
+            return bytes;
+        };
+
+    const auto data = frame(1U, false) + frame(2U, true) + frame(3U, false);
+    boost::asio::write(peer, boost::asio::buffer(data));
+
+    for (const std::uint32_t seq : { 1U, 3U })
+    {
+        std::optional<Message::Ptr> received;
+        ASSERT_TRUE(waitFor([&]{ return (received = server_session->receive()).has_value(); }));
+        ASSERT_EQ((*received)->field<std::uint32_t>("seq").get(), seq);
+    }
+
+    auto& receiver = dynamic_cast<TcpTransport&>(*server_session->transport());
+    ASSERT_EQ(receiver.statistics().checksum_failures, 1U);
+    ASSERT_FALSE(server_session->receive().has_value());
+
+    server_session->shutdown();
+}
+
+TEST_F(TcpTransportTests, ResynchronizeAfterCorruptedDeltaFrame)
+{
+    TransportOptions options;
+    options.frame_checksum = true;
+    options.delta_encoding = true;
+    options.string_dictionary = 1U;
+
+    auto server = accept(options);
+    TcpSocket peer { m_ioc };
+    peer.connect(m_acceptor.local_endpoint());
+    auto server_session = server.get();
+
+    struct Frame
+    {
+        TcpTransport::DictionaryFlags flags    {};
+        TcpTransport::DeltaKind       kind     {};
+        std::uint8_t                  bitmap   {};  ///< Fields of a delta frame.
+        std::uint32_t                 seq      {};
+        std::string                   payload  {};  ///< Defined as the identifier 0 or referred to if empty.
+        bool                          corrupt  {};
+    };
+
+    auto encode = [](const Frame& frame)
+        {
+            BinaryWriter body;
+            TypedSerializationContext<BinarySerializer, BinaryWriter> context { body };
+            binary::serialize(context, static_cast<MessageType>(TestMessageType::Sequence));
+            binary::serialize(context, frame.flags);
+            binary::serialize(context, frame.kind);
+            if (frame.kind == TcpTransport::k_delta_frame)
+                binary::serialize(context, frame.bitmap);
+
+            binary::serialize(context, frame.seq);
+            if (frame.kind == TcpTransport::k_keyframe or frame.bitmap & 0x02U)
+            {
+                if (frame.payload.empty())
+                {
+                    binary::serialize(context, std::uint16_t { 1U });
+                }
+                else
+                {
+                    binary::serialize(context, std::uint16_t { 0x8000U });
+                    binary::serialize(context, frame.payload);
+                }
+            }
+
+            BinaryWriter writer;
+            TypedSerializationContext<BinarySerializer, BinaryWriter> frame_context { writer };
+            binary::serialize(frame_context, static_cast<MessageLength>(body.size() + 4U));
+            writer.write(body.data(), body.size());
+            binary::serialize(frame_context, Crc32c::compute(writer.view()));
+
+            std::string bytes { writer.view() };
+            if (frame.corrupt)
+                bytes[8] ^= 0x10;
+            return bytes;
+        };
+
+    // The sender's dictionary holds a single string, so "changed" replaces
+    // "base" in the corrupted delta frame
+    const auto reset = TcpTransport::k_dictionary_reset;
+    std::string data;
+    data += encode({ .flags = reset, .kind = TcpTransport::k_keyframe, .seq = 1U, .payload = "base" });
+    data += encode({ .kind = TcpTransport::k_delta_frame, .bitmap = 0x03U, .seq = 2U, .payload = "changed", .corrupt = true });
+    data += encode({ .kind = TcpTransport::k_delta_frame, .bitmap = 0x01U, .seq = 3U });
+    data += encode({ .kind = TcpTransport::k_keyframe, .seq = 4U });
+    data += encode({ .flags = reset, .kind = TcpTransport::k_keyframe, .seq = 5U, .payload = "changed" });
+    data += encode({ .kind = TcpTransport::k_delta_frame, .bitmap = 0x01U, .seq = 6U });
+    boost::asio::write(peer, boost::asio::buffer(data));
+
+    // The delta frame lacks its base and the keyframe refers to a string
+    // defined in the dropped frame, so both are dropped until the reset
+    for (const std::uint32_t seq : { 1U, 5U, 6U })
+    {
+        std::optional<Message::Ptr> received;
+        ASSERT_TRUE(waitFor([&]{ return (received = server_session->receive()).has_value(); }));
+        ASSERT_EQ((*received)->field<std::uint32_t>("seq").get(), seq);
+        ASSERT_EQ((*received)->field<std::string>("payload").get(), seq == 1U ? "base" : "changed");
+    }
+
+    auto& receiver = dynamic_cast<TcpTransport&>(*server_session->transport());
+    ASSERT_EQ(receiver.statistics().checksum_failures, 1U);
+    ASSERT_FALSE(server_session->receive().has_value());
+
+    server_session->shutdown();
+}
+
+TEST_F(TcpTransportTests, ExchangeChecksummedFrames)
+{
+    auto options = TransportOptions::withCredits(FlowControl::Messages, 4U);
+    options.multiplexing = true;
+    options.max_chunk_size = 64U;
+    options.frame_checksum = true;
+
+    TcpTransportFactory factory { m_ioc };
+    auto server = accept(options);
+    auto transport_res = factory.createTransport(url("?credits=messages&window=4&streams=1&chunk=64&crc=1"));
+    ASSERT_TRUE(transport_res);
+
+    auto server_session = server.get();
+    auto client_session = Session::createNew(2, std::move(transport_res.value()));
+
+    for (std::uint32_t seq = 0U; seq < 8U; ++seq)
+    {
+        auto msg = MessageFactory::getInstance().createMessage(TestMessageType::Sequence, *client_session);
+        msg->field<std::uint32_t>("seq") = seq;
+        msg->field<std::string>("payload") = std::string(200, 'x');
+        client_session->send(std::move(msg));
+    }
+
+    for (std::uint32_t seq = 0U; seq < 8U; ++seq)
+    {
+        std::optional<Message::Ptr> received;
+        ASSERT_TRUE(waitFor([&]{ return (received = server_session->receive()).has_value(); }));
+        ASSERT_EQ((*received)->field<std::uint32_t>("seq").get(), seq);
+        ASSERT_EQ((*received)->field<std::string>("payload").get().size(), 200U);
+    }
+
+    auto& receiver = dynamic_cast<TcpTransport&>(*server_session->transport());
+    ASSERT_EQ(receiver.statistics().checksum_failures, 0U);
+
+    client_session->shutdown();
+    server_session->shutdown();
+}
+
+TEST_F(TcpTransportTests, BorrowFieldsFromReceivedFrame)
+{
+    TransportOptions options {};
+    options.frame_checksum = true;
+
+    TcpTransportFactory factory { m_ioc };
+    auto server = accept(options);
+    auto transport_res = factory.createTransport(url("?crc=1"));
+    ASSERT_TRUE(transport_res);
+
+    auto server_session = server.get();
+    auto client_session = Session::createNew(2, std::move(transport_res.value()));
+
+    const std::string payload = "borrowed";
+    auto msg = MessageFactory::getInstance().createMessage(TestMessageType::Borrowing, *client_session);
+    msg->field<std::uint32_t>("seq") = 1U;
+    msg->field<BorrowedString>("payload") = BorrowedString { payload };
+    client_session->send(std::move(msg));
+
+    std::optional<Message::Ptr> received;
+    ASSERT_TRUE(waitFor([&]{ return (received = server_session->receive()).has_value(); }));
+
+    // The field refers to the block the frame was read into, which still
+    // ends with the checksum
+    const auto& borrowed = std::as_const(**received).field<BorrowedString>("payload").get();
+    const auto& frame = borrowed.buffer();
+    ASSERT_EQ(borrowed.view(), payload);
+    ASSERT_TRUE(frame.contains(borrowed.view()));
+    ASSERT_EQ(frame.data() + frame.size(), borrowed.data() + borrowed.size() + sizeof(Crc32c::Value));
+
+    client_session->shutdown();
+    server_session->shutdown();
+}
@@ -0,0 +1,275 @@
+/**
+ * @file    tls_transport.tests.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+
+ISML_DISABLE_WARNINGS_PUSH
+#   include <gtest/gtest.h>
+#   include <boost/asio/executor_work_guard.hpp>
+#   include <boost/asio/io_context.hpp>
+#   include <boost/asio/ip/tcp.hpp>
+#   include <boost/asio/read.hpp>
+#   include <openssl/pem.h>
+#   include <openssl/x509v3.h>
+ISML_DISABLE_WARNINGS_POP
+
+#include <isml/serialization/serializers/composite_serializer.hpp>
+#include <isml/serialization/serializers/binary_serializer.hpp>
+
+#include <isml/message/message_factory.hpp>
+#include <isml/session/session.hpp>
+#include <isml/transport/tls_transport.hpp>
+#include <isml/transport/tls_transport_factory.hpp>
+
+using namespace isml;
+using namespace std::chrono_literals;
+
+using FieldSerializer = CompositeSerializer<BinarySerializer>;
+
+namespace {
+
+enum TestMessageType : MessageType { Greeting = 0x7E01 };
+
+struct Credentials
+{
+    std::string certificate;
+    std::string private_key;
+};
+
+auto toPem(BIO* bio) -> std::string
+{
+    char* data = nullptr;
+    const auto size = BIO_get_mem_data(bio, &data);
+    return std::string(data, static_cast<std::size_t>(size));
+}
+
+// Self-signed certificate for 127.0.0.1
+auto createCredentials() -> Credentials
+{
+    std::unique_ptr<EVP_PKEY, decltype(&EVP_PKEY_free)> key { EVP_EC_gen("P-256"), EVP_PKEY_free };
+    std::unique_ptr<X509, decltype(&X509_free)> cert { X509_new(), X509_free };
+
+    X509_set_version(cert.get(), 2);
+    ASN1_INTEGER_set(X509_get_serialNumber(cert.get()), 1);
+    X509_gmtime_adj(X509_getm_notBefore(cert.get()), 0);
+    X509_gmtime_adj(X509_getm_notAfter(cert.get()), 60 * 60);
+    X509_set_pubkey(cert.get(), key.get());
+
+    auto* name = X509_get_subject_name(cert.get());
+    X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC, reinterpret_cast<const unsigned char*>("isml"), -1, -1, 0);
+    X509_set_issuer_name(cert.get(), name);
+
+    X509V3_CTX ctx;
+    X509V3_set_ctx_nodb(&ctx);
+    X509V3_set_ctx(&ctx, cert.get(), cert.get(), nullptr, nullptr, 0);
+    auto* ext = X509V3_EXT_conf_nid(nullptr, &ctx, NID_subject_alt_name, "IP:127.0.0.1");
+    X509_add_ext(cert.get(), ext, -1);
+    X509_EXTENSION_free(ext);
+
+    X509_sign(cert.get(), key.get(), EVP_sha256());
+
+    std::unique_ptr<BIO, decltype(&BIO_free)> cert_bio { BIO_new(BIO_s_mem()), BIO_free };
+    PEM_write_bio_X509(cert_bio.get(), cert.get());
+
+    std::unique_ptr<BIO, decltype(&BIO_free)> key_bio { BIO_new(BIO_s_mem()), BIO_free };
+    PEM_write_bio_PrivateKey(key_bio.get(), key.get(), nullptr, nullptr, 0, nullptr, nullptr);
+
+    return { toPem(cert_bio.get()), toPem(key_bio.get()) };
+}
+
+class TlsTransportTests : public ::testing::Test
+{
+protected:
+    auto SetUp() -> void override
+    {
+        MessageFactory::getInstance().addDescriptor(TestMessageType::Greeting, [](MessageDescriptor& descriptor)
+            {
+                descriptor.registerField<FieldSerializer, std::string>("text");
+            });
+
+        const auto credentials = createCredentials();
+        m_server_context.use_certificate(boost::asio::buffer(credentials.certificate), boost::asio::ssl::context::pem);
+        m_server_context.use_private_key(boost::asio::buffer(credentials.private_key), boost::asio::ssl::context::pem);
+        m_client_context.add_certificate_authority(boost::asio::buffer(credentials.certificate));
+        m_client_context.set_verify_mode(boost::asio::ssl::verify_peer);
+
+        m_acceptor.open(boost::asio::ip::tcp::v4());
+        m_acceptor.bind({ boost::asio::ip::make_address("127.0.0.1"), 0 });
+        m_acceptor.listen();
+
+        m_io = std::async(std::launch::async, [this]
+            {
+                auto guard = boost::asio::make_work_guard(m_ioc);
+                m_ioc.run();
+            });
+    }
+
+    auto TearDown() -> void override
+    {
+        m_ioc.stop();
+        m_io.wait();
+    }
+
+    auto url() const -> Url
+    {
+        return Url::parse("tls://127.0.0.1:" + std::to_string(m_acceptor.local_endpoint().port()));
+    }
+
+    // The handshake runs on the IO context, which serves the client as well
+    auto accept() -> std::future<Session::Ptr>
+    {
+        auto session = std::make_shared<std::promise<Session::Ptr>>();
+        auto accepted = session->get_future();
+
+        m_acceptor.async_accept([this, session](const boost::system::error_code& ec, boost::asio::ip::tcp::socket socket)
+            {
+                if (ec)
+                {
+                    session->set_value(nullptr);
+                    return;
+                }
+
+                TlsTransport::asyncAccept(std::move(socket), m_server_context, {}, [session](auto transport_res)
+                    {
+                        session->set_value(transport_res ? Session::createNew(1, std::move(transport_res.value())) : nullptr);
+                    });
+            });
+
+        return accepted;
+    }
+
+    template<typename Predicate>
+    static auto waitFor(Predicate&& predicate) -> bool
+    {
+        for (auto deadline = std::chrono::steady_clock::now() + 5s; std::chrono::steady_clock::now() < deadline;)
+        {
+            if (predicate()) return true;
+            std::this_thread::sleep_for(10ms);
+        }
+        return false;
+    }
+
+protected:
+    boost::asio::io_context        m_ioc            {};
+    std::future<void>              m_io             {};
+    boost::asio::ip::tcp::acceptor m_acceptor       { m_ioc };
+    boost::asio::ssl::context      m_server_context { boost::asio::ssl::context::tls_server };
+    boost::asio::ssl::context      m_client_context { boost::asio::ssl::context::tls_client };
+};
+
+} // namespace
+
+TEST_F(TlsTransportTests, ExchangeMessages)
+{
+    TlsTransportFactory factory { m_ioc, m_client_context };
+    ASSERT_TRUE(factory.supports("tls"));
+
+    auto server = accept();
+    auto transport_res = factory.createTransport(url());
+    ASSERT_TRUE(transport_res);
+
+    auto server_session = server.get();
+    ASSERT_TRUE(server_session);
+    auto client_session = Session::createNew(2, std::move(transport_res.value()));
+
+    auto msg = MessageFactory::getInstance().createMessage(TestMessageType::Greeting, *client_session);
+    msg->field<std::string>("text") = std::string("hello");
+    client_session->send(std::move(msg));
+
+    std::optional<Message::Ptr> received;
+    ASSERT_TRUE(waitFor([&]{ return (received = server_session->receive()).has_value(); }));
+    ASSERT_EQ((*received)->type(), TestMessageType::Greeting);
+    ASSERT_EQ((*received)->field<std::string>("text").get(), "hello");
+
+    client_session->shutdown();
+    server_session->shutdown();
+}
+
+TEST_F(TlsTransportTests, SlowClientDoesntStallAccept)
+{
+    // Connects and never starts the handshake
+    auto stalled_server = accept();
+    boost::asio::ip::tcp::socket stalled { m_ioc };
+    stalled.connect(m_acceptor.local_endpoint());
+
+    TlsTransportFactory factory { m_ioc, m_client_context };
+    auto server = accept();
+    auto transport_res = factory.createTransport(url());
+    ASSERT_TRUE(transport_res);
+
+    auto server_session = server.get();
+    ASSERT_TRUE(server_session);
+    ASSERT_EQ(stalled_server.wait_for(0s), std::future_status::timeout);
+
+    auto client_session = Session::createNew(2, std::move(transport_res.value()));
+    client_session->shutdown();
+    server_session->shutdown();
+
+    stalled.close();
+    ASSERT_FALSE(stalled_server.get());
+}
+
+TEST_F(TlsTransportTests, SendCloseNotifyOnStop)
+{
+    using Stream = boost::asio::ssl::stream<boost::asio::ip::tcp::socket>;
+
+    TlsTransportFactory factory { m_ioc, m_client_context };
+    auto server = std::async(std::launch::async, [this]
+        {
+            auto stream = std::make_unique<Stream>(m_acceptor.accept(), m_server_context);
+            stream->handshake(Stream::server);
+            return stream;
+        });
+
+    auto transport_res = factory.createTransport(url());
+    ASSERT_TRUE(transport_res);
+    auto stream = server.get();
+    auto client_session = Session::createNew(2, std::move(transport_res.value()));
+    client_session->shutdown();
+
+    // A connection closed without the alert is reported as truncated
+    char byte {};
+    boost::system::error_code ec;
+    boost::asio::read(*stream, boost::asio::buffer(&byte, 1U), ec);
+    ASSERT_EQ(ec, boost::asio::error::eof);
+}
+
+TEST_F(TlsTransportTests, ResumeSessionOnReconnect)
+{
+    TlsTransportFactory factory { m_ioc, m_client_context };
+    const auto key = "127.0.0.1:" + std::to_string(m_acceptor.local_endpoint().port());
+
+    {
+        auto server = accept();
+        auto transport_res = factory.createTransport(url());
+        ASSERT_TRUE(transport_res);
+        auto server_session = server.get();
+        ASSERT_TRUE(server_session);
+        auto client_session = Session::createNew(2, std::move(transport_res.value()));
+
+        // TLS 1.3 tickets arrive after the handshake and are picked up by the read loop
+        ASSERT_TRUE(waitFor([&]{ return factory.sessionCache().contains(key); }));
+
+        client_session->shutdown();
+        server_session->shutdown();
+    }
+
+    auto server = accept();
+    auto transport_res = factory.createTransport(url());
+    ASSERT_TRUE(transport_res);
+    auto server_session = server.get();
+    ASSERT_TRUE(server_session);
+
+    auto& transport = dynamic_cast<TlsTransport&>(*transport_res.value());
+    ASSERT_TRUE(transport.sessionReused());
+
+    transport.stop();
+    server_session->shutdown();
+}
@@ -0,0 +1,47 @@
+/**
+ * @file    crc32c.tests.cpp
+ * @author  Oleg E. Vorobiov <o.vorobiov(at)integrasources.com>
+ * @date    19.10.2026
+ */
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+
+ISML_DISABLE_WARNINGS_PUSH
+#   include <gtest/gtest.h>
+ISML_DISABLE_WARNINGS_POP
+
+#include <isml/utility/crc32c.hpp>
+
+using namespace isml;
+
+TEST(Crc32cTests, CheckValue)
+{
+    ASSERT_EQ(Crc32c::compute("123456789"), 0xE3069283U);
+    ASSERT_EQ(Crc32c::computePortable("123456789", 9U), 0xE3069283U);
+    ASSERT_EQ(Crc32c::compute(""), 0U);
+}
+
+TEST(Crc32cTests, MatchesPortableImplementation)
+{
+    std::mt19937 random { 17U };
+    std::string data(4096U + 13U, '\0');
+    for (auto& c : data)
+        c = static_cast<char>(random());
+
+    // Covers the interleaved lanes, whole words and the tail, at any alignment
+    for (std::size_t offset = 0U; offset < 8U; ++offset)
+    {
+        for (std::size_t size = 0U; offset + size <= data.size(); size += 61U)
+        {
+            ASSERT_EQ(Crc32c::compute(data.data() + offset, size),
+                      Crc32c::computePortable(data.data() + offset, size)) << offset << ' ' << size;
+        }
+    }
+
+    const std::string_view text { data };
+    const auto head = Crc32c::compute(text.substr(0U, 1000U));
+    ASSERT_EQ(Crc32c::compute(text.substr(1000U, 3000U), head), Crc32c::compute(text.substr(0U, 4000U)));
+}